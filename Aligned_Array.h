@@ -0,0 +1,104 @@
+#ifndef ALIGNED_ARRAY_H
+#define ALIGNED_ARRAY_H
+/**
+ *  @file Aligned_Array.h
+ *  @brief definition of aligned array class
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <utility>
+#include <memory>
+
+/*! Alignment in bytes of the first element of every Aligned_Array, one cache line */
+#define ARRAY_ALIGNMENT 64
+
+///
+/// \class Aligned_Array
+/// \brief This class acts as an array whose first element starts on a cache
+///        line boundary, so that it can be used as one contiguous block by
+///        the dense kernels
+///
+
+template <typename T>
+class Aligned_Array{
+private:
+  unsigned int m_n; //!< Size of array
+  std::unique_ptr<T[]> m_storage; //!< owned storage, padded so an aligned start can be found inside it
+  T* m_data; //!< first element of the array, aligned to ARRAY_ALIGNMENT when possible
+  //! Allocates storage for n elements and finds the aligned start
+  /// \pre None
+  /// \post m_storage holds n elements starting at m_data, zero initialized if initialize is true and left as they are otherwise
+  /// @param n of type unsigned int
+  /// @param initialize of type bool
+  void allocate(unsigned int n, bool initialize = true);
+public:
+  //! Default Constructor
+  /// \pre None
+  /// \post Aligned_Array object of size 0 is created
+  Aligned_Array();
+  //! Constructor
+  /// \pre None
+  /// \post Aligned_Array object of size n is created, with every element value initialized
+  /// @param n of type unsigned integer
+  Aligned_Array(unsigned int n);
+  //! Constructor with optional initialization
+  /// \pre None
+  /// \post Aligned_Array object of size n is created. If initialize is false the elements are default initialized, so for numbers no page of the storage is touched until its first write
+  /// @param n of type unsigned integer
+  /// @param initialize of type bool
+  Aligned_Array(unsigned int n, bool initialize);
+  //! Copy Constructor
+  /// \pre T must have the operator= defined such that T = T
+  /// \post Calling Object is a copy of ary
+  /// @param ary of type const Aligned_Array<T>&
+  Aligned_Array(const Aligned_Array<T>& ary);
+  //! Move Constructor
+  /// \pre None
+  /// \post rvalue passed is now an lvalue
+  /// @param ary of type Aligned_Array<T>&&
+  Aligned_Array(Aligned_Array<T>&& ary);
+  //! T& [] Operator
+  /// \pre i must be an unsigned integer between 0 and m_n-1
+  /// \post returns T& of the i'th locations in the Aligned_Array. Throws error if i does not satisfy 0 <= i < m_n
+  /// @param i of type unsigned integer
+  T& operator[](unsigned int i);
+  //! const T& [] Operator
+  /// \pre i must be an unsigned integer between 0 and m_n-1
+  /// \post returns const T& of the i'th location in the Aligned_Array. Throws error if i does not satisfy 0 <= i < m_n
+  /// @param i of type unsigned integer
+  const T& operator[](unsigned int i) const;
+  //! Assignment Operator
+  /// \pre None
+  /// \post calling object is a copy of ary
+  /// @param ary of type Aligned_Array<T>
+  Aligned_Array<T>& operator=(Aligned_Array<T> ary);
+  //! Returns size of array
+  /// \pre None
+  /// \post Returns unsigned int that is the size of the array
+  unsigned int size() const;
+  //! Raw pointer to the elements
+  /// \pre None
+  /// \post Returns pointer to the first element, the elements are contiguous. No range checking is done through it
+  T* data();
+  //! Raw pointer to the elements (calling object not mutable in this version)
+  /// \pre None
+  /// \post Returns const pointer to the first element, the elements are contiguous. No range checking is done through it
+  const T* data() const;
+  //! Swap Functions
+  /// \pre None
+  /// \post Swaps the contents of a1 with a2
+  /// @param a1 of type Aligned_Array<T>&
+  /// @param a2 of type Aligned_Array<T>&
+  friend void swap(Aligned_Array& a1, Aligned_Array& a2)
+  {
+    std::swap(a1.m_n, a2.m_n);
+    std::swap(a1.m_storage, a2.m_storage);
+    std::swap(a1.m_data, a2.m_data);
+  }
+
+};
+
+#include "Aligned_Array.hpp"
+
+#endif
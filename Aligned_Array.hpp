@@ -0,0 +1,121 @@
+/**
+ *  @file Aligned_Array.hpp
+ *  @brief implementation of aligned array class
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <utility>
+#include <memory>
+#include <cstdint>
+#include "RangeError.h"
+
+template <typename T>
+void Aligned_Array<T>::allocate(unsigned int n, bool initialize)
+{
+  m_n = n;
+  if(n == 0)
+  {
+    m_storage = nullptr;
+    m_data = nullptr;
+    return;
+  }
+  //Only element sizes that divide the alignment can be shifted onto a boundary
+  const unsigned int padding = (ARRAY_ALIGNMENT % sizeof(T) == 0) ? ARRAY_ALIGNMENT/sizeof(T) : 0;
+  if(initialize)
+    m_storage = std::unique_ptr<T[]>(new T[n+padding]());
+  else
+    m_storage = std::unique_ptr<T[]>(new T[n+padding]);
+  m_data = m_storage.get();
+  if(padding > 0)
+  {
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(m_data);
+    std::uintptr_t offset = (ARRAY_ALIGNMENT - address % ARRAY_ALIGNMENT) % ARRAY_ALIGNMENT;
+    if(offset % sizeof(T) == 0)
+      m_data += offset/sizeof(T);
+  }
+}
+
+template <typename T>
+Aligned_Array<T>::Aligned_Array()
+{
+  m_n = 0;
+  m_storage = nullptr;
+  m_data = nullptr;
+}
+
+template <typename T>
+Aligned_Array<T>::Aligned_Array(unsigned int n)
+{
+  allocate(n);
+}
+
+template <typename T>
+Aligned_Array<T>::Aligned_Array(unsigned int n, bool initialize)
+{
+  allocate(n, initialize);
+}
+
+template <typename T>
+Aligned_Array<T>::Aligned_Array(const Aligned_Array<T>& ary)
+{
+  //If we're constructing, we dont need to delete m_storage;
+  //every element is written below, so there is no need to zero them first
+  allocate(ary.m_n, false);
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    m_data[i] = ary.m_data[i];
+  }
+}
+
+template <typename T>
+Aligned_Array<T>::Aligned_Array(Aligned_Array<T>&& ary)
+{
+  m_n = std::move(ary.m_n);
+  m_storage = std::move(ary.m_storage);
+  m_data = ary.m_data;
+  ary.m_n = 0;
+  ary.m_data = nullptr;
+}
+
+template <typename T>
+T& Aligned_Array<T>::operator[](unsigned int i)
+{
+  if(i >= m_n)
+    throw RangeError(i);
+  return m_data[i];
+}
+
+template <typename T>
+const T& Aligned_Array<T>::operator[](unsigned int i) const
+{
+  if(i >= m_n)
+    throw RangeError(i);
+  return m_data[i];
+}
+
+template <typename T>
+Aligned_Array<T>& Aligned_Array<T>::operator=(Aligned_Array<T> ary)
+{
+  //Old data will be handled by destructor
+  swap((*this), ary);
+  return (*this);
+}
+
+template <typename T>
+unsigned int Aligned_Array<T>::size() const
+{
+  return m_n;
+}
+
+template <typename T>
+T* Aligned_Array<T>::data()
+{
+  return m_data;
+}
+
+template <typename T>
+const T* Aligned_Array<T>::data() const
+{
+  return m_data;
+}
@@ -8,6 +8,7 @@
 */
 
 #include <utility>
+#include <memory>
 
 ///
 /// \class Array
@@ -58,6 +59,14 @@ public:
   /// \pre None
   /// \post Returns unsigned int that is the size of the array
   unsigned int size();
+  //! Raw pointer to the elements
+  /// \pre None
+  /// \post Returns pointer to the first element, the elements are contiguous. No range checking is done through it
+  T* data();
+  //! Raw pointer to the elements (calling object not mutable in this version)
+  /// \pre None
+  /// \post Returns const pointer to the first element, the elements are contiguous. No range checking is done through it
+  const T* data() const;
   //! Swap Functions
   /// \pre None
   /// \post Swaps the contents of a1 with a2
@@ -72,3 +72,15 @@ unsigned int Array<T>::size()
 {
   return m_n;
 }
+
+template <typename T>
+T* Array<T>::data()
+{
+  return m_data.get();
+}
+
+template <typename T>
+const T* Array<T>::data() const
+{
+  return m_data.get();
+}
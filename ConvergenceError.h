@@ -0,0 +1,19 @@
+#ifndef CONVERGENCEERROR_H
+#define CONVERGENCEERROR_H
+/**
+ *  @file ConvergenceError.h
+ *  @brief Class definition for ConvergenceError
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+///
+/// \class ConvergenceError
+/// \brief This class is an exception handling class that is to be thrown
+///        when an iterative method does not reach its tolerance within its
+///        iteration limit
+///
+
+class ConvergenceError{};
+
+#endif
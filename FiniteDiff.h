@@ -12,19 +12,31 @@
 #include "abstract_matrix.h"
 #include "matrix.h"
 #include "symmetric_matrix.h"
+#include "symmetric_banded_matrix.h"
 #include "cholesky.h"
+#include "conjugate_gradient.h"
+#include "poisson_stencil_matrix.h"
+#include "incomplete_cholesky.h"
+#include "multigrid.h"
+#include "fast_poisson_solver.h"
+#include "red_black_sor.h"
+#include "sparse_matrix.h"
+#include "sparse_cholesky.h"
 
 ///
 /// \class FiniteDiff
-/// \brief This class implements the finite difference method using both
-///        gaussian elimination and cholesky decomposition
+/// \brief This class implements the finite difference method using
+///        gaussian elimination, cholesky decomposition, conjugate gradient,
+///        incomplete cholesky preconditioned conjugate gradient, geometric
+///        multigrid, the fast poisson solver (discrete sine transforms),
+///        red-black SOR and supernodal sparse cholesky
 ///
 
 template <typename T_ret, double T_func(double, double)>
 class FiniteDiff
 {
 private:
-  Symmetric_Matrix<T_ret> m_matrix;
+  Symmetric_Banded_Matrix<T_ret> m_matrix;
   Vector<T_ret> m_vector;
   int m_numDivs;
   //Function<T_ret, T_funcPtr> m_func;
@@ -32,6 +44,7 @@ private:
   Cholesky_Decomposition<T_ret> m_cholesky;
   void initMatrix();
   void initVector();
+  void printSolution(const Vector<T_ret>& vec) const;
 public:
   ///
   /// \fn FiniteDiff(int n, const Function<T_ret, T_funcPtr>& f)
@@ -58,6 +71,79 @@ public:
   /// \post cholesky decomposition is performed on the matrix
   ///
   void doCholesky() const;
+
+  ///
+  /// \fn void doCG(double tolerance, unsigned int maxIterations) const
+  /// \brief does conjugate gradient on the stencil of the matrix
+  /// \pre tolerance > 0
+  /// \post conjugate gradient is performed without storing the matrix, the
+  ///       stencil is applied from m_numDivs
+  /// \param tolerance is the relative residual at which iteration stops
+  /// \param maxIterations is the iteration limit, 0 for the size of the system
+  /// \throws ConvergenceError if the tolerance is not reached within maxIterations
+  ///
+  void doCG(double tolerance = 1.0E-10, unsigned int maxIterations = 0) const;
+
+  ///
+  /// \fn void doPCG(double tolerance, unsigned int maxIterations) const
+  /// \brief does conjugate gradient preconditioned by incomplete cholesky
+  /// \pre tolerance > 0
+  /// \post IC(0) of the stencil is computed, in time linear in the size of
+  ///       the system, and preconditioned conjugate gradient is performed on
+  ///       the stencil. This shows the drop in iterations, not in time: the
+  ///       triangular sweeps of IC(0) are sequential and cost several stencil
+  ///       products, and on this smooth right hand side IC(0) only saves about
+  ///       a third of the iterations, so doCG is faster on the wall clock
+  /// \param tolerance is the relative residual at which iteration stops
+  /// \param maxIterations is the iteration limit, 0 for the size of the system
+  /// \throws ConvergenceError if the tolerance is not reached within maxIterations
+  ///
+  void doPCG(double tolerance = 1.0E-10, unsigned int maxIterations = 0) const;
+
+  ///
+  /// \fn void doMultigrid(double tolerance, unsigned int maxCycles, Smoother smoother) const
+  /// \brief does geometric multigrid on the grid
+  /// \pre tolerance > 0
+  /// \post full multigrid followed by V-cycles is performed on the grid
+  ///       hierarchy built from m_numDivs, without storing the matrix
+  /// \param tolerance is the relative residual at which cycling stops
+  /// \param maxCycles is the limit on V-cycles after full multigrid
+  /// \param smoother is the relaxation used on every grid
+  /// \throws ConvergenceError if the tolerance is not reached within maxCycles
+  ///
+  void doMultigrid(double tolerance = 1.0E-10, unsigned int maxCycles = 50, Smoother smoother = RED_BLACK_GAUSS_SEIDEL) const;
+
+  ///
+  /// \fn void doFastPoisson() const
+  /// \brief solves the system with discrete sine transforms
+  /// \pre none
+  /// \post the system is solved directly by diagonalizing it with 2D sine
+  ///       transforms, in O(N log N) without storing the matrix
+  ///
+  void doFastPoisson() const;
+
+  ///
+  /// \fn void doSOR(double tolerance, unsigned int maxIterations) const
+  /// \brief does red-black successive over-relaxation on the grid
+  /// \pre tolerance > 0
+  /// \post SOR with the optimal relaxation factor for h = M_PI/m_numDivs is
+  ///       performed without storing the matrix, each colour sweep shared
+  ///       by the threads of the shared pool
+  /// \param tolerance is the relative residual at which iteration stops
+  /// \param maxIterations is the iteration limit
+  /// \throws ConvergenceError if the tolerance is not reached within maxIterations
+  ///
+  void doSOR(double tolerance = 1.0E-10, unsigned int maxIterations = 100000) const;
+
+  ///
+  /// \fn void doSparseCholesky() const
+  /// \brief does supernodal sparse cholesky decomposition on the matrix
+  /// \pre the matrix must be positive definite
+  /// \post the system is solved by a sparse factor of the matrix in the
+  ///       nested dissection order of the graph of the matrix
+  /// \throws PositiveDefError if the matrix is not positive definite
+  ///
+  void doSparseCholesky() const;
 };
 
 #include "FiniteDiff.hpp"
@@ -6,6 +6,7 @@
 */
 
 #include <math.h>
+#include "thread_pool.h"
 
 template <typename T_ret, double T_func(double, double)>
 FiniteDiff<T_ret, T_func>::FiniteDiff(int n)
@@ -19,21 +20,29 @@ template <typename T_ret, double T_func(double, double)>
 void FiniteDiff<T_ret, T_func>::initMatrix()
 {
   int size = static_cast<int>(pow(m_numDivs-1, 2));
-  //Penta Diagonal Matrix
-  m_matrix = Symmetric_Matrix<T_ret>(size);
+  int side = m_numDivs-1;
+  //Penta Diagonal Matrix, the outer diagonals are m_numDivs-1 away from the main diagonal
+  m_matrix = Symmetric_Banded_Matrix<T_ret>(size, m_numDivs-1);
 
-  for(int i = 0; i < size; i++)
+  //Row i sets (i, i), (i, i+1) and (i+side, i). The last is stored in row
+  //i+side, often in another band, but every element is written by exactly
+  //one i, so bands of rows can go to the pool without a race
+  Symmetric_Banded_Matrix<T_ret>& matrix = m_matrix;
+  Thread_Pool::shared().parallel_for(0, size, Thread_Pool::grain(3), [&matrix, size, side](unsigned int first, unsigned int last)
   {
-    m_matrix.get_elem(i, i) = 1;
-    if(i < size-1 && ((i+1) % (m_numDivs-1) != 0))
+    for(int i = first; i < static_cast<int>(last); i++)
     {
-      m_matrix.get_elem(i, i+1) = -0.25;
+      matrix.get_elem(i, i) = 1;
+      if(i < size-1 && ((i+1) % side != 0))
+      {
+        matrix.get_elem(i, i+1) = -0.25;
+      }
+      if(i < size-side)
+      {
+        matrix.get_elem(i+side, i) = -0.25;
+      }
     }
-    if(i < size-(m_numDivs-1))
-    {
-      m_matrix.get_elem(i+(m_numDivs-1), i) = -0.25;
-    }
-  }
+  });
   return;
 }
 
@@ -41,41 +50,49 @@ template <typename T_ret, double T_func(double, double)>
 void FiniteDiff<T_ret, T_func>::initVector()
 {
   int size = static_cast<int>(pow(m_numDivs-1, 2));
+  int side = m_numDivs-1;
   //side lengths pf domain are both PI long
   double h = M_PI/m_numDivs;
-  double x = 0;
-  double y = 0;
-  //bools for stencil
-  //left, down, right , up
-  bool l, d, r, u;
 
   m_vector = Vector<T_ret>(size);
 
-  for(int i = 0; i < size; i++)
+  //Each row of the grid is a task of the pool
+  Vector<T_ret>& rhs = m_vector;
+  Thread_Pool::shared().parallel_for(0, side, Thread_Pool::grain(side), [&rhs, side, h](unsigned int first, unsigned int last)
   {
-    x+=h;
-    //wrap
-    if(!(i % (m_numDivs-1)))
+    //bools for stencil
+    //left, down, right , up
+    bool l, d, r, u;
+    for(int row = first; row < static_cast<int>(last); row++)
     {
-      x = h;
-      y += h;
+      //The coordinates are added up a step at a time, as a sweep over the
+      //whole grid would, so the tests against the boundary see the same values
+      double y = 0;
+      for(int k = 0; k <= row; k++)
+        y += h;
+      double x = 0;
+      for(int col = 0; col < side; col++)
+      {
+        int i = row*side+col;
+        x += h;
+        l = (x == h);
+        d = (y == h);
+        //top of the square used in PI, also the right side
+        r = (x == M_PI-h);
+        u = (y == M_PI-h);
+
+        //Compute
+        if(l)
+          rhs[i]+=T_func(x-h, y);
+        if(d)
+          rhs[i]+=T_func(x, y-h);
+        if(r)
+          rhs[i]+=T_func(x+h, y);
+        if(u)
+          rhs[i]+=T_func(x, y+h);
+      }
     }
-    l = (x == h);
-    d = (y == h);
-    //top of the square used in PI, also the right side
-    r = (x == M_PI-h);
-    u = (y == M_PI-h);
-
-    //Compute
-    if(l)
-      m_vector[i]+=T_func(x-h, y);
-    if(d)
-      m_vector[i]+=T_func(x, y-h);
-    if(r)
-      m_vector[i]+=T_func(x+h, y);
-    if(u)
-      m_vector[i]+=T_func(x, y+h);
-  }
+  });
   m_vector = m_vector * 0.25;
   //std::cout << m_vector << std::endl;
   return;
@@ -85,14 +102,7 @@ template <typename T_ret, double T_func(double, double)>
 void FiniteDiff<T_ret, T_func>::doGauss() const
 {
   Vector<T_ret> vec(m_gauss(m_matrix, m_vector));
-  for(int i = m_numDivs-1; i > 0; i--)
-  {
-    for(int j = 0; j < m_numDivs-1; j++)
-    {
-      std::cout << std::fixed << std::setprecision(8) << vec[(i-1)*(m_numDivs-1)+j] << " ";
-    }
-    std::cout << std::endl;
-  }
+  printSolution(vec);
 }
 
 template <typename T_ret, double T_func(double, double)>
@@ -100,6 +110,66 @@ void FiniteDiff<T_ret, T_func>::doCholesky() const
 {
   Vector<T_ret> vec(m_cholesky(m_matrix, m_vector));
   //std::cout << vec << std::endl;
+  printSolution(vec);
+}
+
+template <typename T_ret, double T_func(double, double)>
+void FiniteDiff<T_ret, T_func>::doCG(double tolerance, unsigned int maxIterations) const
+{
+  Conjugate_Gradient<T_ret> cg(tolerance, maxIterations);
+  Vector<T_ret> vec(cg(Poisson_Stencil_Matrix<T_ret>(m_numDivs), m_vector));
+  printSolution(vec);
+}
+
+template <typename T_ret, double T_func(double, double)>
+void FiniteDiff<T_ret, T_func>::doPCG(double tolerance, unsigned int maxIterations) const
+{
+  Conjugate_Gradient<T_ret> cg(tolerance, maxIterations);
+  Poisson_Stencil_Matrix<T_ret> stencil(m_numDivs);
+  Incomplete_Cholesky<T_ret> preconditioner(stencil);
+  Vector<T_ret> vec(cg(stencil, m_vector, preconditioner));
+  printSolution(vec);
+}
+
+template <typename T_ret, double T_func(double, double)>
+void FiniteDiff<T_ret, T_func>::doMultigrid(double tolerance, unsigned int maxCycles, Smoother smoother) const
+{
+  Multigrid<T_ret> multigrid(m_numDivs, smoother);
+  Vector<T_ret> vec(multigrid(m_vector, tolerance, maxCycles));
+  printSolution(vec);
+}
+
+template <typename T_ret, double T_func(double, double)>
+void FiniteDiff<T_ret, T_func>::doFastPoisson() const
+{
+  Fast_Poisson_Solver<T_ret> solver(m_numDivs);
+  Vector<T_ret> vec(solver(m_vector));
+  printSolution(vec);
+}
+
+template <typename T_ret, double T_func(double, double)>
+void FiniteDiff<T_ret, T_func>::doSparseCholesky() const
+{
+  Sparse_Matrix<T_ret> matrix(m_matrix);
+  Sparse_Cholesky<T_ret> cholesky;
+  cholesky.analyze(matrix);
+  cholesky.factor(matrix);
+  Vector<T_ret> vec(cholesky.solve(m_vector));
+  printSolution(vec);
+}
+
+template <typename T_ret, double T_func(double, double)>
+void FiniteDiff<T_ret, T_func>::doSOR(double tolerance, unsigned int maxIterations) const
+{
+  Red_Black_SOR<T_ret> sor(m_numDivs);
+  Vector<T_ret> vec(sor(m_vector, tolerance, maxIterations));
+  printSolution(vec);
+}
+
+template <typename T_ret, double T_func(double, double)>
+void FiniteDiff<T_ret, T_func>::printSolution(const Vector<T_ret>& vec) const
+{
+  //Top row of the grid first
   for(int i = m_numDivs-1; i > 0; i--)
   {
     for(int j = 0; j < m_numDivs-1; j++)
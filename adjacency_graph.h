@@ -0,0 +1,118 @@
+#ifndef ADJACENCY_GRAPH_H
+#define ADJACENCY_GRAPH_H
+
+/**
+ *  @file adjacency_graph.h
+ *  @brief Class defintion for adjacency graph
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "Aligned_Array.h"
+#include "abstract_matrix.h"
+#include "symmetric_banded_matrix.h"
+#include "sparse_matrix.h"
+
+///
+/// \class Adjacency_Graph
+/// \brief This class is the undirected graph of the pattern of a symmetric
+///        matrix, used by the fill and bandwidth reducing orderings. Node i
+///        is unknown i, and i and j are neighbours when element (i, j) or
+///        (j, i) is not zero. The neighbours of each node are stored in
+///        increasing order, without the node itself.
+///
+
+class Adjacency_Graph
+{
+private:
+  unsigned int m_n; //!< number of nodes
+  Aligned_Array<unsigned int> m_start; //!< neighbours of node i are at m_start[i] to m_start[i+1]-1 of m_adjacent
+  Aligned_Array<unsigned int> m_adjacent; //!< neighbour lists of all of the nodes
+  //! Fills the neighbour lists from a pattern
+  /// \pre m_n is set. is_edge(i, j) tells if i and j are neighbours for j < i, and is only true for j >= first(i)
+  /// \post m_start and m_adjacent hold the graph
+  template <typename Edge, typename First>
+  void build(Edge is_edge, First first);
+public:
+  //! Default Constructor
+  /// \pre None
+  /// \post Graph with no nodes is created
+  Adjacency_Graph():m_n(0),m_start(1){}
+  //! Constructor from neighbour lists
+  /// \pre start has n+1 elements, the neighbours of node i are adjacent[start[i]] to adjacent[start[i+1]-1]. Each edge is listed from both of its ends
+  /// \post Graph is created. Throws error if start does not have n+1 elements or the lists are not valid
+  /// @param n of type unsigned int
+  /// @param start of type const Aligned_Array<unsigned int>&
+  /// @param adjacent of type const Aligned_Array<unsigned int>&
+  Adjacency_Graph(unsigned int n, const Aligned_Array<unsigned int>& start, const Aligned_Array<unsigned int>& adjacent);
+  //! Constructor from a matrix
+  /// \pre m is square. Comparison to 0 must be defined for T
+  /// \post Graph of the pattern of m + m^T is created. Throws error if m is not square
+  /// @param m of type const Abstract_Matrix<T>&
+  template <typename T>
+  Adjacency_Graph(const Abstract_Matrix<T>& m);
+  //! Constructor from a banded matrix
+  /// \pre Comparison to 0 must be defined for T
+  /// \post Graph of the pattern of m is created, reading only the band
+  /// @param m of type const Symmetric_Banded_Matrix<T>&
+  template <typename T>
+  Adjacency_Graph(const Symmetric_Banded_Matrix<T>& m);
+  //! Constructor from a sparse matrix
+  /// \pre m is square. Comparison to 0 must be defined for T
+  /// \post Graph of the pattern of m + m^T is created, in time proportional to the stored elements. Throws error if m is not square
+  /// @param m of type const Sparse_Matrix<T>&
+  template <typename T>
+  Adjacency_Graph(const Sparse_Matrix<T>& m);
+  //! Five point stencil graph
+  /// \pre None
+  /// \post Returns the graph of a rows x cols grid, node r*cols+c is joined to the nodes left, right, above and below it
+  /// @param rows of type unsigned int
+  /// @param cols of type unsigned int
+  static Adjacency_Graph grid(unsigned int rows, unsigned int cols);
+  //! Returns the number of nodes
+  /// \pre None
+  /// \post Returns the number of nodes
+  unsigned int size() const;
+  //! Returns the number of neighbours of a node
+  /// \pre i < size()
+  /// \post Returns the number of neighbours of node i
+  /// @param i of type unsigned int
+  unsigned int degree(unsigned int i) const;
+  //! Raw pointer to the list offsets
+  /// \pre None
+  /// \post Returns a pointer to the size()+1 offsets of the neighbour lists
+  const unsigned int* start() const;
+  //! Raw pointer to the neighbour lists
+  /// \pre None
+  /// \post Returns a pointer to the neighbour lists
+  const unsigned int* adjacent() const;
+  //! Builds the level structure of a node inside its region
+  /// \pre root < size(). region is nullptr for the whole graph, or has an element per node and the region of root is the nodes i with region[i] == region[root]. level and mark have an element per node, none of mark equal to stamp. queue has room for the region
+  /// \post queue holds the count nodes of the region of root connected to it, in breadth first order and marked with stamp. level holds their distance from root. Returns the number of levels
+  /// @param root of type unsigned int
+  /// @param region of type const unsigned int*
+  /// @param mark of type unsigned int*
+  /// @param stamp of type unsigned int
+  /// @param level of type unsigned int*
+  /// @param queue of type unsigned int*
+  /// @param count of type unsigned int&
+  unsigned int level_structure(unsigned int root, const unsigned int* region, unsigned int* mark, unsigned int stamp,
+                               unsigned int* level, unsigned int* queue, unsigned int& count) const;
+  //! Finds a pseudo-peripheral node of a region
+  /// \pre As for level_structure(), with stamp larger than all of mark
+  /// \post Returns a node at the end of a long path through the region of root, by the method of George and Liu. Its level structure is left in queue, level and mark, marked with stamp-1, and depth holds its number of levels. stamp is advanced past the stamps used
+  /// @param root of type unsigned int
+  /// @param region of type const unsigned int*
+  /// @param mark of type unsigned int*
+  /// @param stamp of type unsigned int&
+  /// @param level of type unsigned int*
+  /// @param queue of type unsigned int*
+  /// @param count of type unsigned int&
+  /// @param depth of type unsigned int&
+  unsigned int peripheral_node(unsigned int root, const unsigned int* region, unsigned int* mark, unsigned int& stamp,
+                               unsigned int* level, unsigned int* queue, unsigned int& count, unsigned int& depth) const;
+};
+
+#include "adjacency_graph.hpp"
+
+#endif
@@ -0,0 +1,227 @@
+/**
+ *  @file adjacency_graph.hpp
+ *  @brief Class implmentation for adjacency graph
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <algorithm>
+#include "RangeError.h"
+#include "DimensionError.h"
+#include "MatrixDimError.h"
+#include "InputError.h"
+
+template <typename Edge, typename First>
+void Adjacency_Graph::build(Edge is_edge, First first)
+{
+  //Count the neighbours of each node, then fill them in. Row i adds its
+  //smaller neighbours, and the later rows add the larger ones, so every
+  //list comes out in increasing order
+  m_start = Aligned_Array<unsigned int>(m_n+1);
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    for(unsigned int j = first(i); j < i; j++)
+    {
+      if(is_edge(i, j))
+      {
+        m_start[i+1]++;
+        m_start[j+1]++;
+      }
+    }
+  }
+  for(unsigned int i = 0; i < m_n; i++)
+    m_start[i+1] += m_start[i];
+
+  m_adjacent = Aligned_Array<unsigned int>(m_start[m_n]);
+  Aligned_Array<unsigned int> next(m_start);
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    for(unsigned int j = first(i); j < i; j++)
+    {
+      if(is_edge(i, j))
+      {
+        m_adjacent[next[i]++] = j;
+        m_adjacent[next[j]++] = i;
+      }
+    }
+  }
+}
+
+inline Adjacency_Graph::Adjacency_Graph(unsigned int n, const Aligned_Array<unsigned int>& start, const Aligned_Array<unsigned int>& adjacent)
+  :m_n(n),m_start(start),m_adjacent(adjacent)
+{
+  if(start.size() != n+1)
+    throw DimensionError(start.size());
+  if(start[0] != 0 || start[n] != adjacent.size())
+    throw InputError();
+  for(unsigned int i = 0; i < n; i++)
+  {
+    if(start[i+1] < start[i])
+      throw InputError();
+    for(unsigned int k = start[i]; k < start[i+1]; k++)
+    {
+      if(adjacent[k] >= n || adjacent[k] == i)
+        throw InputError();
+    }
+  }
+}
+
+template <typename T>
+Adjacency_Graph::Adjacency_Graph(const Abstract_Matrix<T>& m)
+{
+  if(m.num_rows() != m.num_cols())
+    throw MatrixDimError(m.num_rows(), m.num_cols());
+  m_n = m.num_rows();
+  build([&m](unsigned int i, unsigned int j){ return m(i, j) != 0 || m(j, i) != 0; },
+        [](unsigned int){ return 0u; });
+}
+
+template <typename T>
+Adjacency_Graph::Adjacency_Graph(const Symmetric_Banded_Matrix<T>& m)
+{
+  m_n = m.num_rows();
+  unsigned int band = m.bandwidth();
+  build([&m](unsigned int i, unsigned int j){ return m(i, j) != 0; },
+        [band](unsigned int i){ return i > band ? i-band : 0; });
+}
+
+template <typename T>
+Adjacency_Graph::Adjacency_Graph(const Sparse_Matrix<T>& m)
+{
+  if(m.num_rows() != m.num_cols())
+    throw MatrixDimError(m.num_rows(), m.num_cols());
+  m_n = m.num_rows();
+  const unsigned int* row_start = m.row_start();
+  const unsigned int* columns = m.col_index();
+  const T* values = m.values();
+
+  //Every stored element gives an edge from both ends. An element stored on
+  //both sides of the diagonal gives it twice, so the lists are sorted and
+  //the repeats removed afterwards
+  Aligned_Array<unsigned int> start(m_n+1);
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    for(unsigned int k = row_start[i]; k < row_start[i+1]; k++)
+    {
+      if(columns[k] != i && values[k] != 0)
+      {
+        start[i+1]++;
+        start[columns[k]+1]++;
+      }
+    }
+  }
+  for(unsigned int i = 0; i < m_n; i++)
+    start[i+1] += start[i];
+  Aligned_Array<unsigned int> adjacent(start[m_n]);
+  Aligned_Array<unsigned int> next(start);
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    for(unsigned int k = row_start[i]; k < row_start[i+1]; k++)
+    {
+      if(columns[k] != i && values[k] != 0)
+      {
+        adjacent[next[i]++] = columns[k];
+        adjacent[next[columns[k]]++] = i;
+      }
+    }
+  }
+
+  m_start = Aligned_Array<unsigned int>(m_n+1);
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    unsigned int* first = adjacent.data()+start[i];
+    unsigned int* last = adjacent.data()+start[i+1];
+    std::sort(first, last);
+    m_start[i+1] = m_start[i] + static_cast<unsigned int>(std::unique(first, last)-first);
+  }
+  m_adjacent = Aligned_Array<unsigned int>(m_start[m_n]);
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    for(unsigned int k = 0; k < m_start[i+1]-m_start[i]; k++)
+      m_adjacent[m_start[i]+k] = adjacent[start[i]+k];
+  }
+}
+
+inline Adjacency_Graph Adjacency_Graph::grid(unsigned int rows, unsigned int cols)
+{
+  Adjacency_Graph result;
+  result.m_n = rows*cols;
+  result.build([cols](unsigned int i, unsigned int j){ return i-j == cols || (i-j == 1 && i%cols != 0); },
+               [cols](unsigned int i){ return i > cols ? i-cols : 0; });
+  return result;
+}
+
+inline unsigned int Adjacency_Graph::size() const
+{
+  return m_n;
+}
+
+inline unsigned int Adjacency_Graph::degree(unsigned int i) const
+{
+  if(i >= m_n)
+    throw RangeError(i);
+  return m_start[i+1]-m_start[i];
+}
+
+inline const unsigned int* Adjacency_Graph::start() const
+{
+  return m_start.data();
+}
+
+inline const unsigned int* Adjacency_Graph::adjacent() const
+{
+  return m_adjacent.data();
+}
+
+inline unsigned int Adjacency_Graph::level_structure(unsigned int root, const unsigned int* region, unsigned int* mark, unsigned int stamp,
+                                                     unsigned int* level, unsigned int* queue, unsigned int& count) const
+{
+  const unsigned int* start = m_start.data();
+  const unsigned int* adjacent = m_adjacent.data();
+  unsigned int id = (region != nullptr ? region[root] : 0);
+  count = 0;
+  queue[count++] = root;
+  mark[root] = stamp;
+  level[root] = 0;
+  for(unsigned int head = 0; head < count; head++)
+  {
+    unsigned int node = queue[head];
+    for(unsigned int k = start[node]; k < start[node+1]; k++)
+    {
+      unsigned int next = adjacent[k];
+      if(mark[next] != stamp && (region == nullptr || region[next] == id))
+      {
+        mark[next] = stamp;
+        level[next] = level[node]+1;
+        queue[count++] = next;
+      }
+    }
+  }
+  return level[queue[count-1]]+1;
+}
+
+inline unsigned int Adjacency_Graph::peripheral_node(unsigned int root, const unsigned int* region, unsigned int* mark, unsigned int& stamp,
+                                                     unsigned int* level, unsigned int* queue, unsigned int& count, unsigned int& depth) const
+{
+  const unsigned int* start = m_start.data();
+  depth = level_structure(root, region, mark, stamp++, level, queue, count);
+  while(true)
+  {
+    //Move to the node of smallest degree in the deepest level if it sees further
+    unsigned int candidate = queue[count-1];
+    for(unsigned int i = count-1; i > 0 && level[queue[i-1]] == depth-1; i--)
+    {
+      if(start[queue[i-1]+1]-start[queue[i-1]] < start[candidate+1]-start[candidate])
+        candidate = queue[i-1];
+    }
+    unsigned int candidate_depth = level_structure(candidate, region, mark, stamp++, level, queue, count);
+    if(candidate_depth <= depth)
+    {
+      //The candidate sees at least as far as root did, so its structure,
+      //the one left behind, is just as deep
+      depth = candidate_depth;
+      return candidate;
+    }
+    depth = candidate_depth;
+  }
+}
@@ -10,27 +10,72 @@
 
 
 #include "symmetric_matrix.h"
+#include "symmetric_banded_matrix.h"
+#include "lower_matrix.h"
+#include "matrix.h"
 #include "vector.h"
 
 ///
 /// \class Cholesky_Decomposition
-/// \brief This class is the cholesky algorithm implemented as a class
+/// \brief This class is the cholesky algorithm implemented as a class. The
+///        factor L of the last call to factor() is kept, so a system can be
+///        solved for any number of right hand sides without factoring again.
+///        Dense matrices are factored a tile at a time, right looking, with
+///        the kernels of Tile_Kernels. Each kernel call on a tile is a task of
+///        a Task_Graph, run on the shared Thread_Pool as soon as the tiles it
+///        reads are final
 ///
 
 template <typename T>
 class Cholesky_Decomposition
 {
+private:
+  unsigned int m_n; //!< number of rows and cols of the factored matrix, 0 before factor() is called
+  bool m_is_banded; //!< true when the factor is held in m_band, false when it is held in m_lower
+  Lower_Matrix<T> m_lower; //!< factor of a dense symmetric matrix
+  Symmetric_Banded_Matrix<T> m_band; //!< factor of a banded matrix, stored in the lower band
+  static const unsigned int TILE_SIZE = 128; //!< rows and columns of a tile, sized so the tiles of one update fit in L2
+  //! Tiled factorization
+  /// \pre a points to an n x n row major matrix with row stride stride holding a positive definite matrix in its lower triangle
+  /// \post The lower triangle of a holds L with a = L(L^T), with the tile tasks run on the shared pool. Throws error if a is not positive definite or is singular
+  static void factor_tiles(T* a, unsigned int n, unsigned int stride);
 public:
   //! Constructor
   /// \pre None
-  /// \post Functor Cholesky object created
-  Cholesky_Decomposition(){}
+  /// \post Functor Cholesky object created, with no factor
+  Cholesky_Decomposition():m_n(0),m_is_banded(false){}
+  //! Factorization
+  /// \pre m is positive definite
+  /// \post The calling object holds L with m = L(L^T). Each tile column is factored, the tiles below it are solved and the trailing matrix takes a rank update, all on cache sized tiles. Throws error if m is not positive definite or is singular
+  /// @param m of type const Symmetric_Matrix<T>&
+  void factor(const Symmetric_Matrix<T>& m);
+  //! Factorization for banded matricies
+  /// \pre m is positive definite
+  /// \post The calling object holds L with m = L(L^T). L keeps the bandwidth of m, so only elements inside the band are visited. Throws error if m is not positive definite or is singular
+  /// @param m of type const Symmetric_Banded_Matrix<T>&
+  void factor(const Symmetric_Banded_Matrix<T>& m);
+  //! Solve with the kept factor
+  /// \pre factor() has been called. The size of b matches the rows of the factored matrix
+  /// \post Returns x of mx = b, using L for the forward sweep and its columns for the backward sweep. Throws error if the sizes do not match
+  /// @param b of type const Vector<T>&
+  Vector<T> solve(const Vector<T>& b) const;
+  //! Solve for many right hand sides with the kept factor
+  /// \pre factor() has been called. B has as many rows as the factored matrix, each column is a right hand side
+  /// \post Returns X of mX = B. The sweeps run over whole rows of B, so all the right hand sides are solved together. Throws error if the rows of B do not match
+  /// @param B of type const Matrix<T>&
+  Matrix<T> solve(const Matrix<T>& B) const;
   //! Function Operator
   /// \pre Symmetric matrix rows (and cols) size match the size of b. M is not singular.
   /// \post Solves the system mx=b, returning x. Throws error if the size of the matrix's rows (and cols) dont match the szie of b. Throws error if M is singular.
   /// @param m of type const Symmetric_Matrix<T>&
   /// @param b of type const Vector<T>&
   Vector<T> operator()(const Symmetric_Matrix<T>& m, const Vector<T>& b) const;
+  //! Function Operator for banded matricies
+  /// \pre Symmetric banded matrix rows (and cols) size match the size of b. M is not singular.
+  /// \post Solves the system mx=b, returning x. The factor keeps the bandwidth of m, so only elements inside the band are visited. Throws error if the size of the matrix's rows (and cols) dont match the szie of b. Throws error if M is singular.
+  /// @param m of type const Symmetric_Banded_Matrix<T>&
+  /// @param b of type const Vector<T>&
+  Vector<T> operator()(const Symmetric_Banded_Matrix<T>& m, const Vector<T>& b) const;
 };
 
 #include "cholesky.hpp"
@@ -6,77 +6,259 @@
 */
 
 #include "vector.h"
+#include "matrix.h"
 #include "DimensionError.h"
 #include "SingularError.h"
 #include "lower_matrix.h"
+#include "symmetric_banded_matrix.h"
 #include "PositiveDefError.h"
+#include "vector_kernels.h"
+#include "tile_kernels.h"
+#include "task_graph.h"
+#include "thread_pool.h"
+#include "Array.h"
 #include <math.h>
+#include <algorithm>
+#include <limits>
 
+//Definition for the tile size, it is bound to a reference by std::min
 template <typename T>
-Vector<T> Cholesky_Decomposition<T>::operator()(const Symmetric_Matrix<T>& m, const Vector<T>& b) const
+const unsigned int Cholesky_Decomposition<T>::TILE_SIZE;
+
+template <typename T>
+void Cholesky_Decomposition<T>::factor_tiles(T* a, unsigned int n, unsigned int stride)
 {
-  double tolerance = 1.0E-30;
-  if(m.num_rows() != b.size())
-    throw DimensionError(b.size());
-  //Symmetrix matrix is a square always so lets just grab one thing
-  int n = m.num_rows();
-  Lower_Matrix<T> L(n);
+  unsigned int tiles = (n+TILE_SIZE-1)/TILE_SIZE;
+  const unsigned int none = std::numeric_limits<unsigned int>::max();
+  Task_Graph graph;
+  //Last task to write each tile, every later task that reads or writes
+  //the tile waits for it. Updates of one tile are chained in the order of
+  //the loop, so the result does not depend on the number of threads
+  Array<unsigned int> last(tiles*tiles);
+  for(unsigned int t = 0; t < tiles*tiles; t++)
+    last[t] = none;
+  auto after = [&graph, &last, none](unsigned int tile, unsigned int task)
+  {
+    if(last[tile] != none)
+      graph.depend(last[tile], task);
+  };
 
-  //Decompose the matrix
-  for(int i = 0; i < n; i++)
+  for(unsigned int tk = 0; tk < tiles; tk++)
   {
-    for(int j = 0; j <= i; j++)
+    unsigned int k = tk*TILE_SIZE;
+    unsigned int kb = std::min(TILE_SIZE, n-k);
+    T* diagonal = a + k*stride + k;
+    unsigned int potrf = graph.add([=]{ Tile_Kernels<T>::potrf(kb, diagonal, stride); });
+    after(tk*tiles+tk, potrf);
+    last[tk*tiles+tk] = potrf;
+    for(unsigned int ti = tk+1; ti < tiles; ti++)
     {
-      double sum = 0;
-      if(i == j)
-      {
-        for(int k = 0; k < j; k++)
-          if (fabs(L(j, k)) > tolerance) sum += pow(L(j, k), 2);
-        if((m(j, j) - sum) < 0)
-          throw PositiveDefError();
-        L.get_elem(j, j) = sqrt(m(j, j) - sum);
-      }
-      else
+      unsigned int i = ti*TILE_SIZE;
+      unsigned int ib = std::min(TILE_SIZE, n-i);
+      T* below = a + i*stride + k;
+      unsigned int trsm = graph.add([=]{ Tile_Kernels<T>::trsm(ib, kb, diagonal, stride, below, stride); });
+      graph.depend(potrf, trsm);
+      after(ti*tiles+tk, trsm);
+      last[ti*tiles+tk] = trsm;
+    }
+
+    //Trailing update, the lower triangle of what is left loses the outer
+    //product of the tile column just solved
+    for(unsigned int tj = tk+1; tj < tiles; tj++)
+    {
+      unsigned int j = tj*TILE_SIZE;
+      unsigned int jb = std::min(TILE_SIZE, n-j);
+      const T* panel_j = a + j*stride + k;
+      T* target = a + j*stride + j;
+      unsigned int syrk = graph.add([=]{ Tile_Kernels<T>::syrk(jb, kb, panel_j, stride, target, stride); });
+      after(tj*tiles+tk, syrk);
+      after(tj*tiles+tj, syrk);
+      last[tj*tiles+tj] = syrk;
+      for(unsigned int ti = tj+1; ti < tiles; ti++)
       {
-        //Evaluate L(i, j) using the diagonal of L
-        for(int k = 0;  k < j; k++)
-          if (fabs(L(i, k)) > tolerance && fabs(L(j, k)) > tolerance) sum += (L(i, k)*L(j, k));
-        if(fabs(L(j, j)) < tolerance)
-          throw SingularError();
-        L.get_elem(i, j) = (m(i, j) - sum) / L(j, j);
+        unsigned int i = ti*TILE_SIZE;
+        unsigned int ib = std::min(TILE_SIZE, n-i);
+        const T* panel_i = a + i*stride + k;
+        T* update = a + i*stride + j;
+        unsigned int gemm = graph.add([=]{ Tile_Kernels<T>::gemm(ib, jb, kb, panel_i, stride, panel_j, stride, update, stride); });
+        after(ti*tiles+tk, gemm);
+        after(tj*tiles+tk, gemm);
+        after(ti*tiles+tj, gemm);
+        last[ti*tiles+tj] = gemm;
       }
     }
   }
 
-  //Forward
-  Vector<T> y(n);
-  for(int i = 0; i < n; i++)
+  graph.run(Thread_Pool::shared());
+}
+
+template <typename T>
+void Cholesky_Decomposition<T>::factor(const Symmetric_Matrix<T>& m)
+{
+  //Symmetrix matrix is a square always so lets just grab one thing
+  unsigned int n = m.num_rows();
+
+  //The tiles work on a row major copy of the lower triangle
+  Matrix<T> work(n, n);
+  T* a = work.data();
+  unsigned int stride = work.stride();
+  for(unsigned int i = 0; i < n; i++)
+    for(unsigned int j = 0; j <= i; j++)
+      a[i*stride+j] = m(i, j);
+
+  factor_tiles(a, n, stride);
+
+  Lower_Matrix<T> L(n);
+  for(unsigned int i = 0; i < n; i++)
+    for(unsigned int j = 0; j <= i; j++)
+      L.get_elem(i, j) = a[i*stride+j];
+
+  //Only replace the old factor once the new one is complete
+  m_lower = std::move(L);
+  m_band = Symmetric_Banded_Matrix<T>();
+  m_is_banded = false;
+  m_n = n;
+}
+
+template <typename T>
+void Cholesky_Decomposition<T>::factor(const Symmetric_Banded_Matrix<T>& m)
+{
+  double tolerance = 1.0E-30;
+  int n = m.num_rows();
+  int band = m.bandwidth();
+  //L has no fill outside of the band of m, so it is stored in the lower band of a copy of m
+  Symmetric_Banded_Matrix<T> L(m);
+  //Row i of the band holds L(i, k) at a[(i+1)*band + k], so the part of two
+  //rows inside the band is one contiguous dot product
+  T* a = L.data();
+
+  //Decompose the matrix column by column
+  for(int j = 0; j < n; j++)
   {
-    T alpha = b[i];
-    for(int j = 0; j < i; j++)
+    int first = std::max(0, j-band);
+    T* row_j = a + (j+1)*band;
+    double diagonal = row_j[j] - Vector_Kernels<T>::dot(row_j+first, row_j+first, j-first);
+    if(diagonal < 0)
+      throw PositiveDefError();
+    row_j[j] = static_cast<T>(sqrt(diagonal));
+    if(fabs(row_j[j]) < tolerance)
+      throw SingularError();
+
+    //Only the rows within the band below the diagonal are non-zero
+    int last = std::min(n-1, j+band);
+    for(int i = j+1; i <= last; i++)
     {
-      if (L(i, j) != 0 && y[j] != 0) alpha -= L(i, j)*y[j];
+      T* row_i = a + (i+1)*band;
+      int k = std::max(0, i-band);
+      row_i[j] = static_cast<T>((row_i[j] - Vector_Kernels<T>::dot(row_i+k, row_j+k, j-k)) / row_j[j]);
     }
-    y[i] = alpha/L(i, i);
   }
 
-  //Backwards
-  Upper_Matrix<T> LT(L.transpose());
-  Vector<T> x(n);
+  m_band = std::move(L);
+  m_lower = Lower_Matrix<T>();
+  m_is_banded = true;
+  m_n = n;
+}
+
+template <typename T>
+Vector<T> Cholesky_Decomposition<T>::solve(const Vector<T>& b) const
+{
+  if(m_n != b.size())
+    throw DimensionError(b.size());
+  if(!m_is_banded)
+  {
+    //Forward then backward substitution, both on the packed rows of L
+    Vector<T> x(b);
+    m_lower.solve_in_place(x);
+    m_lower.solve_transpose_in_place(x);
+    return x;
+  }
+
+  int n = m_n;
+  int band = m_band.bandwidth();
+  const T* a = m_band.data();
+  //Forward, each row of L inside the band is contiguous
+  Vector<T> x(b);
+  T* y = x.data();
+  for(int i = 0; i < n; i++)
+  {
+    const T* row = a + (i+1)*band;
+    int first = std::max(0, i-band);
+    y[i] = static_cast<T>((y[i] - Vector_Kernels<T>::dot(row+first, y+first, i-first)) / row[i]);
+  }
 
-  double ss = 0;
+  //Backwards, once x[i] is solved it is taken out of the entries above it
+  //using row i of L, which is column i of L transpose
   for(int i = n-1; i >= 0; i--)
   {
-    ss = 0;
-    for(int j = i+1; j < n; j++)
+    const T* row = a + (i+1)*band;
+    int first = std::max(0, i-band);
+    y[i] /= row[i];
+    Vector_Kernels<T>::axpy(-y[i], row+first, y+first, i-first);
+  }
+
+  return x;
+}
+
+template <typename T>
+Matrix<T> Cholesky_Decomposition<T>::solve(const Matrix<T>& B) const
+{
+  if(m_n != B.num_rows())
+    throw DimensionError(B.num_rows());
+  int n = m_n;
+  int band = m_is_banded ? m_band.bandwidth() : n-1;
+  unsigned int rhs = B.num_cols();
+  Matrix<T> X(B);
+
+  //Forward, row i of X takes away L(i, j) times each solved row j above it.
+  //Every update is an axpy across all of the right hand sides
+  for(int i = 0; i < n; i++)
+  {
+    T* xi = X[i].data();
+    for(int j = std::max(0, i-band); j < i; j++)
     {
-      if (fabs(LT(i, j)) > tolerance && fabs(x[j]) > tolerance) ss += LT(i, j)*x[j];
+      T lij = m_is_banded ? m_band(i, j) : m_lower(i, j);
+      Vector_Kernels<T>::axpy(-lij, X[j].data(), xi, rhs);
     }
-    if(fabs(LT(i, i)) < tolerance)
+    T lii = m_is_banded ? m_band(i, i) : m_lower(i, i);
+    if(lii == 0)
       throw SingularError();
-    x[i] = (y[i] - ss) / LT(i, i);
+    Vector_Kernels<T>::scale(xi, 1/lii, xi, rhs);
   }
 
-  return x;
+  //Backwards, once row i is solved it is taken out of the rows above it
+  //using row i of L, which is column i of L transpose
+  for(int i = n-1; i >= 0; i--)
+  {
+    T* xi = X[i].data();
+    T lii = m_is_banded ? m_band(i, i) : m_lower(i, i);
+    Vector_Kernels<T>::scale(xi, 1/lii, xi, rhs);
+    for(int j = std::max(0, i-band); j < i; j++)
+    {
+      T lij = m_is_banded ? m_band(i, j) : m_lower(i, j);
+      Vector_Kernels<T>::axpy(-lij, xi, X[j].data(), rhs);
+    }
+  }
+
+  return X;
+}
 
+template <typename T>
+Vector<T> Cholesky_Decomposition<T>::operator()(const Symmetric_Matrix<T>& m, const Vector<T>& b) const
+{
+  if(m.num_rows() != b.size())
+    throw DimensionError(b.size());
+  Cholesky_Decomposition<T> decomposition;
+  decomposition.factor(m);
+  return decomposition.solve(b);
+}
+
+template <typename T>
+Vector<T> Cholesky_Decomposition<T>::operator()(const Symmetric_Banded_Matrix<T>& m, const Vector<T>& b) const
+{
+  if(m.num_rows() != b.size())
+    throw DimensionError(b.size());
+  Cholesky_Decomposition<T> decomposition;
+  decomposition.factor(m);
+  return decomposition.solve(b);
 }
@@ -0,0 +1,58 @@
+#ifndef CONJUGATE_GRADIENT_H
+#define CONJUGATE_GRADIENT_H
+
+/**
+ *  @file conjugate_gradient.h
+ *  @brief Class defintion for conjugate gradient
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "abstract_matrix.h"
+#include "vector.h"
+#include "preconditioner.h"
+
+///
+/// \class Conjugate_Gradient
+/// \brief This class is the conjugate gradient method implemented as a class.
+///        The matrix is only used through its product with a vector, so it
+///        works for any Abstract_Matrix, including ones that are never stored.
+///        A Preconditioner may be given to reduce the number of iterations
+///
+
+template <typename T>
+class Conjugate_Gradient
+{
+private:
+  double m_tolerance; //!< iteration stops once the residual norm is at most m_tolerance times the norm of b
+  unsigned int m_max_iterations; //!< iteration limit, 0 uses the size of the system
+  //! Preconditioned iteration
+  /// \pre as for operator(). precond is null or has the size of b
+  /// \post Returns x of mx = b, applying precond to each residual when it is not null
+  Vector<T> solve(const Abstract_Matrix<T>& m, const Vector<T>& b, const Preconditioner<T>* precond) const;
+public:
+  //! Constructor
+  /// \pre tolerance > 0
+  /// \post Functor Conjugate_Gradient object created
+  /// @param tolerance of type double
+  /// @param max_iterations of type unsigned int
+  Conjugate_Gradient(double tolerance = 1.0E-10, unsigned int max_iterations = 0)
+    :m_tolerance(tolerance),m_max_iterations(max_iterations){}
+  //! Function Operator
+  /// \pre m is square, symmetric and positive definite. The size of b matches the rows of m.
+  /// \post Solves the system mx=b, returning x. Throws error if the sizes do not match, if m is found not to be positive definite, or if the tolerance is not reached within the iteration limit
+  /// @param m of type const Abstract_Matrix<T>&
+  /// @param b of type const Vector<T>&
+  Vector<T> operator()(const Abstract_Matrix<T>& m, const Vector<T>& b) const;
+  //! Function Operator with a preconditioner
+  /// \pre m is square, symmetric and positive definite, precond is symmetric positive definite. The sizes of b and precond match the rows of m.
+  /// \post Solves the system mx=b with preconditioned conjugate gradient, returning x. Throws error if the sizes do not match, if m is found not to be positive definite, or if the tolerance is not reached within the iteration limit
+  /// @param m of type const Abstract_Matrix<T>&
+  /// @param b of type const Vector<T>&
+  /// @param precond of type const Preconditioner<T>&
+  Vector<T> operator()(const Abstract_Matrix<T>& m, const Vector<T>& b, const Preconditioner<T>& precond) const;
+};
+
+#include "conjugate_gradient.hpp"
+
+#endif
@@ -0,0 +1,77 @@
+/**
+ *  @file conjugate_gradient.hpp
+ *  @brief Class implmentation for conjugate gradient
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <math.h>
+#include "vector.h"
+#include "DimensionError.h"
+#include "MatrixDimError.h"
+#include "PositiveDefError.h"
+#include "ConvergenceError.h"
+#include "parallel_kernels.h"
+
+template <typename T>
+Vector<T> Conjugate_Gradient<T>::operator()(const Abstract_Matrix<T>& m, const Vector<T>& b) const
+{
+  return solve(m, b, nullptr);
+}
+
+template <typename T>
+Vector<T> Conjugate_Gradient<T>::operator()(const Abstract_Matrix<T>& m, const Vector<T>& b, const Preconditioner<T>& precond) const
+{
+  if(precond.size() != b.size())
+    throw DimensionError(precond.size());
+  return solve(m, b, &precond);
+}
+
+template <typename T>
+Vector<T> Conjugate_Gradient<T>::solve(const Abstract_Matrix<T>& m, const Vector<T>& b, const Preconditioner<T>* precond) const
+{
+  if(m.num_rows() != m.num_cols())
+    throw MatrixDimError(m.num_rows(), m.num_cols());
+  if(m.num_rows() != b.size())
+    throw DimensionError(b.size());
+  unsigned int n = b.size();
+  unsigned int limit = (m_max_iterations == 0 ? n : m_max_iterations);
+
+  //Start from x = 0, so the first residual is b. z is the preconditioned
+  //residual, and the first search direction
+  Vector<T> x(n);
+  Vector<T> r(b);
+  Vector<T> z(precond != nullptr ? (*precond)(r) : r);
+  Vector<T> p(z);
+  double rr = Parallel_Kernels<T>::dot(r.data(), r.data(), n);
+  double rz = Parallel_Kernels<T>::dot(r.data(), z.data(), n);
+  double stop = m_tolerance*m_tolerance*rr;
+  if(rr == 0)
+    return x;
+
+  for(unsigned int k = 0; k < limit; k++)
+  {
+    Vector<T> mp(m*p);
+    double pmp = Parallel_Kernels<T>::dot(p.data(), mp.data(), n);
+    if(pmp <= 0)
+      throw PositiveDefError();
+    T alpha = static_cast<T>(rz/pmp);
+    Parallel_Kernels<T>::axpy(alpha, p.data(), x.data(), n);
+    Parallel_Kernels<T>::axpy(-alpha, mp.data(), r.data(), n);
+
+    rr = Parallel_Kernels<T>::dot(r.data(), r.data(), n);
+    if(rr <= stop)
+      return x;
+    if(precond != nullptr)
+      z = (*precond)(r);
+    else
+      z = r;
+    double rz_next = Parallel_Kernels<T>::dot(r.data(), z.data(), n);
+    //p = z + beta*p
+    T beta = static_cast<T>(rz_next/rz);
+    Parallel_Kernels<T>::scale(p.data(), beta, p.data(), n);
+    Parallel_Kernels<T>::axpy(1, z.data(), p.data(), n);
+    rz = rz_next;
+  }
+  throw ConvergenceError();
+}
@@ -0,0 +1,57 @@
+#ifndef FAST_POISSON_SOLVER_H
+#define FAST_POISSON_SOLVER_H
+
+/**
+ *  @file fast_poisson_solver.h
+ *  @brief Class defintion for fast poisson solver
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "vector.h"
+#include "Aligned_Array.h"
+#include "sine_transform.h"
+
+///
+/// \class Fast_Poisson_Solver
+/// \brief This class solves the finite difference system of FiniteDiff,
+///        u - 0.25*(sum of the four neighbours) = f on a square grid of
+///        numDivs divisions per side, with sine transforms. The sines
+///        sin(j*pi*x/numDivs)*sin(k*pi*y/numDivs) are the eigenvectors of the
+///        matrix with eigenvalues 1 - 0.5*(cos(j*pi/numDivs)+cos(k*pi/numDivs)),
+///        so transforming f, dividing by the eigenvalues and transforming
+///        back solves the system in O(N log N) without forming the matrix
+///
+
+template <typename T>
+class Fast_Poisson_Solver
+{
+private:
+  unsigned int m_numDivs; //!< divisions per side of the grid
+  unsigned int m_side; //!< points per side of the grid, m_numDivs-1
+  Sine_Transform<T> m_dst; //!< sine transform along one grid row
+  Aligned_Array<T> m_eigenvalues; //!< 0.5*(1-cos(j*pi/numDivs)) for j = 1..side, one direction's share of an eigenvalue
+  //! Transforms every row
+  /// \pre grid points to side*side elements stored row by row
+  /// \post each row of grid holds its sine transform
+  void transform_rows(T* grid) const;
+  //! Transposes the grid
+  /// \pre grid points to side*side elements stored row by row
+  /// \post grid holds its transpose
+  void transpose(T* grid) const;
+public:
+  //! Constructor
+  /// \pre numDivs > 0
+  /// \post Fast_Poisson_Solver created for a grid with numDivs divisions per side
+  /// @param numDivs of type unsigned int
+  Fast_Poisson_Solver(unsigned int numDivs);
+  //! Function Operator
+  /// \pre f holds the (numDivs-1)^2 points of the grid
+  /// \post Returns u of Au = f. Throws error if the size of f does not match
+  /// @param f of type const Vector<T>&
+  Vector<T> operator()(const Vector<T>& f) const;
+};
+
+#include "fast_poisson_solver.hpp"
+
+#endif
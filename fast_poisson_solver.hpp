@@ -0,0 +1,65 @@
+/**
+ *  @file fast_poisson_solver.hpp
+ *  @brief Class implmentation for fast poisson solver
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <math.h>
+#include <utility>
+#include "vector.h"
+#include "DimensionError.h"
+
+template <typename T>
+Fast_Poisson_Solver<T>::Fast_Poisson_Solver(unsigned int numDivs)
+  :m_numDivs(numDivs),m_side(numDivs > 0 ? numDivs-1 : 0),m_dst(m_side)
+{
+  m_eigenvalues = Aligned_Array<T>(m_side);
+  for(unsigned int j = 0; j < m_side; j++)
+    m_eigenvalues[j] = static_cast<T>(0.5*(1-cos((j+1)*M_PI/m_numDivs)));
+}
+
+template <typename T>
+void Fast_Poisson_Solver<T>::transform_rows(T* grid) const
+{
+  //Two rows share each complex FFT
+  for(unsigned int r = 0; r < m_side; r += 2)
+    m_dst(grid + r*m_side, (r+1 < m_side ? grid + (r+1)*m_side : nullptr));
+}
+
+template <typename T>
+void Fast_Poisson_Solver<T>::transpose(T* grid) const
+{
+  for(unsigned int r = 0; r < m_side; r++)
+    for(unsigned int c = r+1; c < m_side; c++)
+      std::swap(grid[r*m_side+c], grid[c*m_side+r]);
+}
+
+template <typename T>
+Vector<T> Fast_Poisson_Solver<T>::operator()(const Vector<T>& f) const
+{
+  if(f.size() != m_side*m_side)
+    throw DimensionError(f.size());
+  Vector<T> u(f);
+  T* grid = u.data();
+
+  //2D transform: along the rows, then along the columns by way of a transpose.
+  //The grid is left transposed, which the eigenvalues do not mind since
+  //they are symmetric in j and k
+  transform_rows(grid);
+  transpose(grid);
+  transform_rows(grid);
+
+  //Divide by the eigenvalues. Two 2D transforms scale by (numDivs/2)^2,
+  //which is undone here as well
+  T scale = static_cast<T>(4.0/(static_cast<double>(m_numDivs)*m_numDivs));
+  const T* eigenvalues = m_eigenvalues.data();
+  for(unsigned int j = 0; j < m_side; j++)
+    for(unsigned int k = 0; k < m_side; k++)
+      grid[j*m_side+k] *= scale/(eigenvalues[j]+eigenvalues[k]);
+
+  transform_rows(grid);
+  transpose(grid);
+  transform_rows(grid);
+  return u;
+}
@@ -0,0 +1,66 @@
+#ifndef FFT_H
+#define FFT_H
+
+/**
+ *  @file fft.h
+ *  @brief Class defintion for fft
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <complex>
+#include "Aligned_Array.h"
+
+///
+/// \class FFT
+/// \brief This class is the fast fourier transform of a fixed length,
+///        X[k] = sum of x[j]*exp(-2*pi*i*j*k/n). The twiddle factors are
+///        computed once by the constructor. Powers of two use an in place
+///        iterative radix-2 transform, any other length is turned into a
+///        convolution of power of two length (Bluestein's algorithm)
+///
+
+template <typename T>
+class FFT
+{
+private:
+  unsigned int m_n; //!< length of the transform
+  unsigned int m_size; //!< length of the radix-2 transforms, m_n itself when it is a power of two
+  bool m_bluestein; //!< true when m_n is not a power of two
+  Aligned_Array<std::complex<T>> m_twiddles; //!< exp(-2*pi*i*k/m_size) for k < m_size/2
+  Aligned_Array<unsigned int> m_bitrev; //!< bit reversal of each index below m_size
+  Aligned_Array<std::complex<T>> m_chirp; //!< exp(-pi*i*k*k/m_n) for k < m_n, Bluestein only
+  Aligned_Array<std::complex<T>> m_chirp_fft; //!< transform of the wrapped conjugate chirp, Bluestein only
+  //! Radix-2 transform
+  /// \pre data points to m_size elements
+  /// \post data holds its forward transform, or the unscaled inverse transform when inverse is true
+  void radix2(std::complex<T>* data, bool inverse) const;
+  //! Forward transform of any length
+  /// \pre data points to m_n elements
+  /// \post data holds its forward transform
+  void transform(std::complex<T>* data) const;
+public:
+  //! Constructor
+  /// \pre None
+  /// \post FFT object of length n created, with all of its tables
+  /// @param n of type unsigned int
+  FFT(unsigned int n = 0);
+  //! Forward transform
+  /// \pre data points to size() elements
+  /// \post data holds X[k] = sum of x[j]*exp(-2*pi*i*j*k/n)
+  /// @param data of type std::complex<T>*
+  void forward(std::complex<T>* data) const;
+  //! Inverse transform
+  /// \pre data points to size() elements
+  /// \post data holds x[j] = (1/n) * sum of X[k]*exp(2*pi*i*j*k/n), undoing forward()
+  /// @param data of type std::complex<T>*
+  void inverse(std::complex<T>* data) const;
+  //! Returns the length of the transform
+  /// \pre None
+  /// \post Returns n
+  unsigned int size() const;
+};
+
+#include "fft.hpp"
+
+#endif
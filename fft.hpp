@@ -0,0 +1,139 @@
+/**
+ *  @file fft.hpp
+ *  @brief Class implmentation for fft
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <math.h>
+#include <complex>
+#include <utility>
+#include "Aligned_Array.h"
+
+template <typename T>
+FFT<T>::FFT(unsigned int n):m_n(n),m_size(n > 0 ? 1 : 0),m_bluestein(false)
+{
+  while(m_size < n)
+    m_size *= 2;
+  if(m_size != n)
+  {
+    //The convolution needs room for 2n-1 terms without wrapping
+    m_bluestein = true;
+    while(m_size < 2*n-1)
+      m_size *= 2;
+  }
+
+  unsigned int bits = 0;
+  while((1u << bits) < m_size)
+    bits++;
+  m_bitrev = Aligned_Array<unsigned int>(m_size);
+  for(unsigned int i = 0; i < m_size; i++)
+  {
+    unsigned int reversed = 0;
+    for(unsigned int b = 0; b < bits; b++)
+      if(i & (1u << b))
+        reversed |= 1u << (bits-1-b);
+    m_bitrev[i] = reversed;
+  }
+  m_twiddles = Aligned_Array<std::complex<T>>(m_size/2);
+  for(unsigned int k = 0; k < m_size/2; k++)
+  {
+    double angle = -2*M_PI*k/m_size;
+    m_twiddles[k] = std::complex<T>(static_cast<T>(cos(angle)), static_cast<T>(sin(angle)));
+  }
+
+  if(m_bluestein)
+  {
+    m_chirp = Aligned_Array<std::complex<T>>(m_n);
+    m_chirp_fft = Aligned_Array<std::complex<T>>(m_size);
+    for(unsigned int k = 0; k < m_n; k++)
+    {
+      //k*k is reduced modulo 2n first so the angle stays accurate for large k
+      unsigned long long square = static_cast<unsigned long long>(k)*k % (2ull*m_n);
+      double angle = -M_PI*static_cast<double>(square)/m_n;
+      m_chirp[k] = std::complex<T>(static_cast<T>(cos(angle)), static_cast<T>(sin(angle)));
+    }
+    std::complex<T>* b = m_chirp_fft.data();
+    b[0] = std::conj(m_chirp[0]);
+    for(unsigned int k = 1; k < m_n; k++)
+      b[k] = b[m_size-k] = std::conj(m_chirp[k]);
+    radix2(b, false);
+  }
+}
+
+template <typename T>
+void FFT<T>::radix2(std::complex<T>* data, bool inverse) const
+{
+  const unsigned int* bitrev = m_bitrev.data();
+  for(unsigned int i = 0; i < m_size; i++)
+    if(i < bitrev[i])
+      std::swap(data[i], data[bitrev[i]]);
+
+  const std::complex<T>* twiddles = m_twiddles.data();
+  for(unsigned int half = 1; half < m_size; half *= 2)
+  {
+    //Butterflies of span 2*half use every (m_size/(2*half))th twiddle
+    unsigned int step = m_size/(2*half);
+    for(unsigned int start = 0; start < m_size; start += 2*half)
+    {
+      for(unsigned int k = 0; k < half; k++)
+      {
+        std::complex<T> w = twiddles[k*step];
+        if(inverse)
+          w = std::conj(w);
+        std::complex<T> t = w*data[start+k+half];
+        data[start+k+half] = data[start+k] - t;
+        data[start+k] += t;
+      }
+    }
+  }
+}
+
+template <typename T>
+void FFT<T>::transform(std::complex<T>* data) const
+{
+  if(!m_bluestein)
+  {
+    radix2(data, false);
+    return;
+  }
+  //X[k] = chirp[k] * sum of (x[j]*chirp[j]) * conj(chirp[k-j]), a
+  //convolution done with power of two transforms
+  Aligned_Array<std::complex<T>> work(m_size);
+  std::complex<T>* a = work.data();
+  const std::complex<T>* chirp = m_chirp.data();
+  const std::complex<T>* b = m_chirp_fft.data();
+  for(unsigned int k = 0; k < m_n; k++)
+    a[k] = data[k]*chirp[k];
+  radix2(a, false);
+  for(unsigned int k = 0; k < m_size; k++)
+    a[k] *= b[k];
+  radix2(a, true);
+  T scale = static_cast<T>(1)/static_cast<T>(m_size);
+  for(unsigned int k = 0; k < m_n; k++)
+    data[k] = a[k]*chirp[k]*scale;
+}
+
+template <typename T>
+void FFT<T>::forward(std::complex<T>* data) const
+{
+  transform(data);
+}
+
+template <typename T>
+void FFT<T>::inverse(std::complex<T>* data) const
+{
+  //The inverse is the conjugate of the forward transform of the conjugate
+  for(unsigned int k = 0; k < m_n; k++)
+    data[k] = std::conj(data[k]);
+  transform(data);
+  T scale = static_cast<T>(1)/static_cast<T>(m_n);
+  for(unsigned int k = 0; k < m_n; k++)
+    data[k] = std::conj(data[k])*scale;
+}
+
+template <typename T>
+unsigned int FFT<T>::size() const
+{
+  return m_n;
+}
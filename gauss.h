@@ -11,6 +11,7 @@
 #include <iostream>
 #include "abstract_matrix.h"
 #include "symmetric_matrix.h"
+#include "symmetric_banded_matrix.h"
 #include "vector.h"
 
 ///
@@ -34,10 +35,17 @@ public:
 
   //! Solves the system and returns the vector x
   /// \pre m must be nonsingular. m must be square. m_b must be the size of m_A.num_rows().
-  /// \post Solves system of linear equations and returns the vectors x in Ax = b. Throws error if m is singular, if m is not a square matrix, and if b is not the size of m.num_rows()
+  /// \post Solves system of linear equations and returns the vectors x in Ax = b, with the blocked LU of LU_Factorization on a dense copy. matrix is not changed. Throws error if m is singular, if m is not a square matrix, and if b is not the size of m.num_rows()
   /// @param matrix of type const Symmetric_Matrix<T>&
   /// @param b of type const Vector<T>& b
-  Vector<T> operator()(Symmetric_Matrix<T>& matrix, Vector<T> b) const;
+  Vector<T> operator()(const Symmetric_Matrix<T>& matrix, Vector<T> b) const;
+
+  //! Solves the banded system and returns the vector x
+  /// \pre m must be nonsingular. b must be the size of m.num_rows().
+  /// \post Solves system of linear equations and returns the vectors x in Ax = b using a banded LU with scaled partial pivoting. The matrix is never made dense: the factor only stores the band below the diagonal and the band above it widened by row interchanges. Throws error if m is singular and if b is not the size of m.num_rows()
+  /// @param matrix of type const Symmetric_Banded_Matrix<T>&
+  /// @param b of type Vector<T>
+  Vector<T> operator()(const Symmetric_Banded_Matrix<T>& matrix, Vector<T> b) const;
 };
 
 #include "gauss.hpp"
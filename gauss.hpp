@@ -12,6 +12,8 @@
 #include "matrix.h"
 #include <math.h>
 #include "DimensionError.h"
+#include "lu_factorization.h"
+#include <algorithm>
 
 #include <iostream>
 using namespace std;
@@ -23,230 +25,113 @@ Vector<T> Gauss<T>::operator()(const Abstract_Matrix<T>& A, Vector<T> b) const
     throw DimensionError(A.num_rows());
   if(A.num_rows() != A.num_cols())
     throw MatrixDimError(A.num_rows(), A.num_cols());
-  //Ax=b, vector to solve for
-  Vector<T> x(b.size());
-  Matrix<T> matrix(A);
-  int n = matrix.num_rows(); // n x n matrix
-  Array<T> s(n); //need n spots for row maximums
-  Array<unsigned int> l(n);
-  int i, j, k;
-  double smax = 0;
-  double xmult = 0;
-  double absolute_a = 0;
-  double r = 0;
-  double rmax = 0;
-  double tolerance = 0.005;
-
-  //Scalding vector
-  for(i = 0; i < n; i++)
-  {
-    l[i] = i;
-    smax = 0;
-    for(j = 0; j < n; j++)
-    {
-      absolute_a = fabs(matrix(i, j));
-      if(absolute_a > smax)
-        smax = absolute_a;
-    }
-    s[i] = smax;
-  }
-  //steps
-  for(k = 0; k < n-1; k++)
-  {
-    //choose pivot equation
-    rmax = 0;
-    j=k;
-    for(i = k; i < n; i++)
-    {
-      if(fabs(s[l[i]]) < tolerance)
-        throw SingularError();
-      r = fabs(matrix(l[i], k) / s[l[i]]);
-      if (r > rmax)
-      {
-        rmax = r;
-        j = i;
-      }
-    }
-    //interchance indecies
-    std::swap(l[j], l[k]);
-    //Eliminate
-    for(i=k+1; i < n; i++)
-    {
-      if(fabs(matrix(l[k], k)) < tolerance)
-        throw SingularError();
-      xmult = matrix(l[i], k) / matrix(l[k], k);
-      //Prevent modification of Upper Triangular matricies
-      //std::cout << "test" << std::endl;
-      if(matrix(l[i], k) != xmult)
-        matrix.get_elem(l[i], k) = xmult;
-      for(j = k+1; j < n; j++)
-      {
-        //Added to prevent modification of Upper triangular matrcies
-        //std::cout << l[i] << " " << j << std::endl;
-        if(matrix(l[i], j) != matrix(l[i], j) - (xmult*matrix(l[k], j)))
-          matrix.get_elem(l[i], j) = matrix(l[i], j) - (xmult*matrix(l[k], j));
-      }
-    }
-  }
-
-  //Start forward elimination
-  for(k = 0; k < n-1; k++)
-  {
-    for(i = k+1; i < n; i++)
-    {
-      b[l[i]] -= matrix(l[i], k)*b[l[k]];
-    }
-  }
-
-  //Start backwards solving
-  double ss = 0;
-  for(i = n-1; i >= 0; i--)
-  {
-    ss = b[l[i]];
-    for(j = i+1; j < n; j++)
-    {
-      ss -= matrix(l[i], j)*x[j];
-    }
-    if(fabs(matrix(l[i], i)) < tolerance)
-      throw SingularError();
-    x[i] = ss / matrix(l[i], i);
-  }
-
-  return x;
+  //The factors are only needed for this one solve, use LU_Factorization
+  //directly to solve again with the same matrix
+  LU_Factorization<T> lu;
+  lu.factor(A);
+  return lu.solve(b);
 }
 
 template <typename T>
-Vector<T> Gauss<T>::operator()(Symmetric_Matrix<T>& matrix, Vector<T> b) const
+Vector<T> Gauss<T>::operator()(const Symmetric_Matrix<T>& matrix, Vector<T> b) const
 {
+  //Symmetric storage is only half of the matrix, the dense factorization
+  //works on a full copy and leaves matrix as it was
+  return (*this)(static_cast<const Abstract_Matrix<T>&>(matrix), b);
+}
 
-  // if (mat.num_rows() != b.size()) {
-  //   throw sizeErr(b.getSize());
-  // }
-  //
-  // double tolerance = 0.00001;
-  //
-  // int dimension = b.getSize();
-  // Matrix<T> A(mat);
-  //
-  // for (int i = 0; i < dimension; i++) {
-  //   T pivotVal = A(i, i);
-  //   for (int j = i; j < dimension && j < i + 4; j++) {
-  //     A.get_elem(i, j) = A(i, j) / pivotVal;
-  //   }
-  //   b[i] = b[i] / pivotVal;
-  //   for (int j = i+1; j < dimension && j < i + 4; j++) {
-  //     if (fabs(A(j, i)) > tolerance && fabs(b[i]) > tolerance) b[j] -= A(j, i) * b[i];
-  //     if (fabs(A(j, i)) > tolerance) {
-  //       for(int k = 0; k < dimension; k++) {
-  //         A.get_elem(i, k) -= A(j, i)*A(j, k);
-  //       }
-  //     }
-  //   }
-  // }
-  //
-  // for (int i = dimension - 1; i > 0; i--) {
-  //   for (int j = i-1; j > -1 && i - j > 4; j--) {
-  //     if (fabs(b[i]) > tolerance && fabs(A(j, i))) b[j] -= b[i] * A(j, i);
-  //   }
-  // }
-  //
-  // return b;
-
-
-
-
-
+template <typename T>
+Vector<T> Gauss<T>::operator()(const Symmetric_Banded_Matrix<T>& matrix, Vector<T> b) const
+{
   if(b.size() != matrix.num_rows())
     throw DimensionError(matrix.num_rows());
-  if(matrix.num_rows() != matrix.num_cols())
-    throw MatrixDimError(matrix.num_rows(), matrix.num_cols());
-  //Ax=b, vector to solve for
-  Vector<T> x(b.size());
-  //Matrix<T> matrix(A);
   int n = matrix.num_rows(); // n x n matrix
+  //Row interchanges can only pull rows from at most lower rows below, which
+  //widens the upper band of the factor to lower+upper
+  int lower = matrix.bandwidth();
+  int upper = 2*lower;
+  //Each row i holds columns i-lower through i+upper
+  int width = lower+upper+1;
+  Array<T> a(n*width);
   Array<T> s(n); //need n spots for row maximums
-  Array<unsigned int> l(n);
-  int i, j, k;
+  Array<int> piv(n);
+  Vector<T> x(n);
+  int i, j, k, p;
   double smax = 0;
   double xmult = 0;
-  double absolute_a = 0;
   double r = 0;
   double rmax = 0;
   double tolerance = 0.005;
 
-  //Scalding vector
+  //Copy the band and build the scaling vector
   for(i = 0; i < n; i++)
   {
-    l[i] = i;
     smax = 0;
-    for(j = 0; j < n; j++)
+    for(j = std::max(0, i-lower); j <= std::min(n-1, i+lower); j++)
     {
-      absolute_a = fabs(matrix(i, j));
-      if(absolute_a > smax)
-        smax = absolute_a;
+      a[i*width+j-i+lower] = matrix(i, j);
+      if(fabs(matrix(i, j)) > smax)
+        smax = fabs(matrix(i, j));
     }
     s[i] = smax;
   }
   //steps
   for(k = 0; k < n-1; k++)
   {
+    int last = std::min(n-1, k+lower);
+    int ucol = std::min(n-1, k+upper);
     //choose pivot equation
     rmax = 0;
-    j=k;
-    for(i = k; i < n; i++)
+    p = k;
+    for(i = k; i <= last; i++)
     {
-      if(fabs(s[l[i]]) < tolerance)
+      if(fabs(s[i]) < tolerance)
         throw SingularError();
-      r = fabs(matrix(l[i], k) / s[l[i]]);
+      r = fabs(a[i*width+k-i+lower] / s[i]);
       if (r > rmax)
       {
         rmax = r;
-        j = i;
+        p = i;
       }
     }
-    //interchance indecies
-    std::swap(l[j], l[k]);
+    //interchange rows, only the columns that can be non-zero
+    piv[k] = p;
+    if(p != k)
+    {
+      for(j = k; j <= ucol; j++)
+        std::swap(a[k*width+j-k+lower], a[p*width+j-p+lower]);
+      std::swap(s[k], s[p]);
+    }
+    if(fabs(a[k*width+lower]) < tolerance)
+      throw SingularError();
     //Eliminate
-    for(i=k+1; i < n; i++)
+    for(i = k+1; i <= last; i++)
     {
-      if(fabs(matrix(l[k], k)) < tolerance)
-        throw SingularError();
-      xmult = matrix(l[i], k) / matrix(l[k], k);
-      //Prevent modification of Upper Triangular matricies
-      //std::cout << "test" << std::endl;
-      if(matrix(l[i], k) != xmult)
-        matrix.get_elem(l[i], k) = xmult;
-      for(j = k+1; j < n; j++)
-      {
-        //Added to prevent modification of Upper triangular matrcies
-        //std::cout << l[i] << " " << j << std::endl;
-        if(matrix(l[i], j) != matrix(l[i], j) - (xmult*matrix(l[k], j)))
-          matrix.get_elem(l[i], j) = matrix(l[i], j) - (xmult*matrix(l[k], j));
-      }
+      xmult = a[i*width+k-i+lower] / a[k*width+lower];
+      a[i*width+k-i+lower] = xmult;
+      for(j = k+1; j <= ucol; j++)
+        a[i*width+j-i+lower] -= xmult*a[k*width+j-k+lower];
     }
   }
 
-  //Start forward elimination
+  //Start forward elimination, replaying the interchanges in order
   for(k = 0; k < n-1; k++)
   {
-    for(i = k+1; i < n; i++)
-    {
-      if (fabs(matrix(l[i], k)) > tolerance && fabs(b[l[k]]) > tolerance) b[l[i]] -= matrix(l[i], k)*b[l[k]];
-    }
+    std::swap(b[k], b[piv[k]]);
+    for(i = k+1; i <= std::min(n-1, k+lower); i++)
+      b[i] -= a[i*width+k-i+lower]*b[k];
   }
 
   //Start backwards solving
   double ss = 0;
   for(i = n-1; i >= 0; i--)
   {
-    ss = b[l[i]];
-    for(j = i+1; j < n; j++)
-    {
-      if (fabs(matrix(l[i], j)) > tolerance && fabs(x[j]) > tolerance) ss -= matrix(l[i], j)*x[j];
-    }
-    if(fabs(matrix(l[i], i)) < tolerance)
+    ss = b[i];
+    for(j = i+1; j <= std::min(n-1, i+upper); j++)
+      ss -= a[i*width+j-i+lower]*x[j];
+    if(fabs(a[i*width+lower]) < tolerance)
       throw SingularError();
-    x[i] = ss / matrix(l[i], i);
+    x[i] = ss / a[i*width+lower];
   }
 
   return x;
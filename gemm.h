@@ -0,0 +1,89 @@
+#ifndef GEMM_H
+#define GEMM_H
+
+/**
+ *  @file gemm.h
+ *  @brief Class defintion for gemm
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "Aligned_Array.h"
+
+///
+/// \class Gemm
+/// \brief This class is a cache blocked general matrix multiplcation kernel
+///        (C += A*B) on row major storage implemented as a class. B is
+///        packed into KC x NC panels that stay in L2/L3, A into MC x KC panels
+///        that stay in L2, and an MR x NR register tile of C is accumulated
+///        by the micro kernel from panels that stream through L1. The packing
+///        storage belongs to the calling thread and is reused between calls.
+///
+
+template <typename T>
+class Gemm
+{
+private:
+  static const unsigned int MR = 4; //!< rows of C held in registers by the micro kernel
+  static const unsigned int NR = 8; //!< columns of C held in registers by the micro kernel
+  static const unsigned int KC = 256; //!< depth of a packed panel, sized so an MR x KC and KC x NR sliver fit in L1
+  static const unsigned int MC = 96; //!< rows of a packed A block, sized for L2
+  static const unsigned int NC = 2048; //!< columns of a packed B block, sized for L3
+  //! Packs a block of A into MR row slivers
+  /// \pre a points to an mc x kc block with row stride lda, mc <= MC and kc <= KC. packed has room for mc rounded up to a multiple of MR, times kc, elements
+  /// \post packed holds the block sliver by sliver, each sliver kc columns of MR values with missing rows zero
+  void pack_a(unsigned int mc, unsigned int kc, const T* a, unsigned int lda, T* packed) const;
+  //! Packs a block of B into NR column slivers
+  /// \pre b points to a kc x nc block whose element (p, j) is b[p*row_step + j*col_step], kc <= KC and nc <= NC. packed has room for kc times nc rounded up to a multiple of NR elements
+  /// \post packed holds the block times scale sliver by sliver, each sliver kc rows of NR values with missing columns zero
+  void pack_b(unsigned int kc, unsigned int nc, const T* b, unsigned int row_step, unsigned int col_step, T scale, T* packed) const;
+  //! Register tiled micro kernel
+  /// \pre a and b are packed slivers of depth kc. c points to an mr x nr tile with row stride ldc, mr <= MR, nr <= NR
+  /// \post The product of the slivers is added to the tile of c
+  void micro_kernel(unsigned int kc, const T* a, const T* b, T* c, unsigned int ldc, unsigned int mr, unsigned int nr) const;
+  //! Blocked product shared by the operators
+  /// \pre a is m x k with row stride lda, b is k x n with element (p, j) at b[p*row_step + j*col_step] and c is m x n with row stride ldc
+  /// \post c holds c + scale*a*b
+  void multiply(unsigned int m, unsigned int n, unsigned int k, const T* a, unsigned int lda, const T* b, unsigned int row_step, unsigned int col_step, T scale, T* c, unsigned int ldc) const;
+  //! Returns packing storage of this thread
+  /// \pre None
+  /// \post storage holds at least size elements, grown only when it is too small, and its data is returned
+  /// @param storage of type Aligned_Array<T>&
+  /// @param size of type unsigned int
+  static T* buffer(Aligned_Array<T>& storage, unsigned int size);
+public:
+  //! Constructor
+  /// \pre None
+  /// \post Functor Gemm object created
+  Gemm(){}
+  //! Function Operator
+  /// \pre a is m x k with row stride lda, b is k x n with row stride ldb and c is m x n with row stride ldc. Operator* and operator+ must be defined for T
+  /// \post c holds c + a*b
+  /// @param m of type unsigned int
+  /// @param n of type unsigned int
+  /// @param k of type unsigned int
+  /// @param a of type const T*
+  /// @param lda of type unsigned int
+  /// @param b of type const T*
+  /// @param ldb of type unsigned int
+  /// @param c of type T*
+  /// @param ldc of type unsigned int
+  void operator()(unsigned int m, unsigned int n, unsigned int k, const T* a, unsigned int lda, const T* b, unsigned int ldb, T* c, unsigned int ldc) const;
+  //! Subtracts a product with a transposed matrix
+  /// \pre a is m x k with row stride lda, b is n x k with row stride ldb and c is m x n with row stride ldc. Operator* and operator+ must be defined for T
+  /// \post c holds c - a(b^T). b is packed straight from its rows, no transposed copy is made
+  /// @param m of type unsigned int
+  /// @param n of type unsigned int
+  /// @param k of type unsigned int
+  /// @param a of type const T*
+  /// @param lda of type unsigned int
+  /// @param b of type const T*
+  /// @param ldb of type unsigned int
+  /// @param c of type T*
+  /// @param ldc of type unsigned int
+  void subtract_transposed(unsigned int m, unsigned int n, unsigned int k, const T* a, unsigned int lda, const T* b, unsigned int ldb, T* c, unsigned int ldc) const;
+};
+
+#include "gemm.hpp"
+
+#endif
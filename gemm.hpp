@@ -0,0 +1,136 @@
+/**
+ *  @file gemm.hpp
+ *  @brief Class implmentation for gemm
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <algorithm>
+#include "Aligned_Array.h"
+
+//Definitions for the blocking constants, they are bound to references by std::min
+template <typename T>
+const unsigned int Gemm<T>::MR;
+template <typename T>
+const unsigned int Gemm<T>::NR;
+template <typename T>
+const unsigned int Gemm<T>::KC;
+template <typename T>
+const unsigned int Gemm<T>::MC;
+template <typename T>
+const unsigned int Gemm<T>::NC;
+
+template <typename T>
+void Gemm<T>::pack_a(unsigned int mc, unsigned int kc, const T* a, unsigned int lda, T* packed) const
+{
+  for(unsigned int i = 0; i < mc; i += MR)
+  {
+    unsigned int mr = std::min(MR, mc-i);
+    for(unsigned int p = 0; p < kc; p++)
+    {
+      for(unsigned int r = 0; r < mr; r++)
+        packed[r] = a[(i+r)*lda+p];
+      //Pad the last sliver so the micro kernel never needs a bounds check
+      for(unsigned int r = mr; r < MR; r++)
+        packed[r] = 0;
+      packed += MR;
+    }
+  }
+}
+
+template <typename T>
+void Gemm<T>::pack_b(unsigned int kc, unsigned int nc, const T* b, unsigned int row_step, unsigned int col_step, T scale, T* packed) const
+{
+  for(unsigned int j = 0; j < nc; j += NR)
+  {
+    unsigned int nr = std::min(NR, nc-j);
+    for(unsigned int p = 0; p < kc; p++)
+    {
+      for(unsigned int q = 0; q < nr; q++)
+        packed[q] = scale*b[p*row_step+(j+q)*col_step];
+      for(unsigned int q = nr; q < NR; q++)
+        packed[q] = 0;
+      packed += NR;
+    }
+  }
+}
+
+template <typename T>
+void Gemm<T>::micro_kernel(unsigned int kc, const T* a, const T* b, T* c, unsigned int ldc, unsigned int mr, unsigned int nr) const
+{
+  //The fixed trip counts let the compiler keep the whole tile in vector registers
+  T ab[MR][NR] = {};
+  for(unsigned int p = 0; p < kc; p++)
+  {
+    for(unsigned int i = 0; i < MR; i++)
+    {
+      T alpha = a[i];
+      for(unsigned int j = 0; j < NR; j++)
+        ab[i][j] += alpha*b[j];
+    }
+    a += MR;
+    b += NR;
+  }
+  for(unsigned int i = 0; i < mr; i++)
+    for(unsigned int j = 0; j < nr; j++)
+      c[i*ldc+j] += ab[i][j];
+}
+
+template <typename T>
+T* Gemm<T>::buffer(Aligned_Array<T>& storage, unsigned int size)
+{
+  if(storage.size() < size)
+    storage = Aligned_Array<T>(size, false);
+  return storage.data();
+}
+
+template <typename T>
+void Gemm<T>::operator()(unsigned int m, unsigned int n, unsigned int k, const T* a, unsigned int lda, const T* b, unsigned int ldb, T* c, unsigned int ldc) const
+{
+  multiply(m, n, k, a, lda, b, ldb, 1, 1, c, ldc);
+}
+
+template <typename T>
+void Gemm<T>::subtract_transposed(unsigned int m, unsigned int n, unsigned int k, const T* a, unsigned int lda, const T* b, unsigned int ldb, T* c, unsigned int ldc) const
+{
+  //Element (p, j) of b^T is row j, column p of b
+  multiply(m, n, k, a, lda, b, 1, ldb, -1, c, ldc);
+}
+
+template <typename T>
+void Gemm<T>::multiply(unsigned int m, unsigned int n, unsigned int k, const T* a, unsigned int lda, const T* b, unsigned int row_step, unsigned int col_step, T scale, T* c, unsigned int ldc) const
+{
+  if(m == 0 || n == 0 || k == 0)
+    return;
+  //Small products only use as much of the panels as they need, rounded up
+  //to whole slivers. The panels are kept by each thread, so tile tasks
+  //calling this many times do not allocate
+  static thread_local Aligned_Array<T> a_storage;
+  static thread_local Aligned_Array<T> b_storage;
+  T* packed_a = buffer(a_storage, std::min(MC, (m+MR-1)/MR*MR)*std::min(KC, k));
+  T* packed_b = buffer(b_storage, std::min(KC, k)*std::min(NC, (n+NR-1)/NR*NR));
+
+  for(unsigned int jc = 0; jc < n; jc += NC)
+  {
+    unsigned int nc = std::min(NC, n-jc);
+    for(unsigned int pc = 0; pc < k; pc += KC)
+    {
+      unsigned int kc = std::min(KC, k-pc);
+      pack_b(kc, nc, b+pc*row_step+jc*col_step, row_step, col_step, scale, packed_b);
+      for(unsigned int ic = 0; ic < m; ic += MC)
+      {
+        unsigned int mc = std::min(MC, m-ic);
+        pack_a(mc, kc, a+ic*lda+pc, lda, packed_a);
+        //Macro kernel, walk the packed block one register tile at a time
+        for(unsigned int jr = 0; jr < nc; jr += NR)
+        {
+          for(unsigned int ir = 0; ir < mc; ir += MR)
+          {
+            micro_kernel(kc, packed_a+ir*kc, packed_b+jr*kc,
+                         c+(ic+ir)*ldc+jc+jr, ldc, std::min(MR, mc-ir), std::min(NR, nc-jr));
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,65 @@
+#ifndef INCOMPLETE_CHOLESKY_H
+#define INCOMPLETE_CHOLESKY_H
+/**
+ *  @file incomplete_cholesky.h
+ *  @brief Class defintion for incomplete cholesky
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "vector.h"
+#include "symmetric_banded_matrix.h"
+#include "poisson_stencil_matrix.h"
+#include "Aligned_Array.h"
+#include "preconditioner.h"
+
+///
+/// \class Incomplete_Cholesky
+/// \brief This class is the zero fill incomplete cholesky preconditioner,
+///        IC(0). L is computed like the factor of Cholesky_Decomposition but
+///        only where the matrix itself is non-zero, all fill is dropped, so
+///        M = L(L^T) has the sparsity of the matrix. L is kept as (L~)D, with
+///        L~ unit lower and D the diagonal of L, so M = (L~)(D^2)(L~^T). The
+///        strictly lower part of L~ is kept row by row, each row listing only
+///        its non-zero columns, and D^2 as its reciprocal, so the substitutions
+///        never divide
+///
+
+template <typename T>
+class Incomplete_Cholesky : public Preconditioner<T>
+{
+private:
+  unsigned int m_n; //!< number of rows and cols of L
+  Aligned_Array<unsigned int> m_row_start; //!< row i of L~ is entries m_row_start[i] to m_row_start[i+1]-1
+  Aligned_Array<unsigned int> m_cols; //!< column of each entry, increasing within a row
+  Aligned_Array<T> m_values; //!< value of each entry
+  Aligned_Array<T> m_inverse_diagonal; //!< reciprocal of the diagonal of D^2
+  //! Computes L~ and D in place on the gathered pattern
+  /// \pre m_row_start, m_cols and m_values hold the strictly lower non-zeros of the matrix, m_inverse_diagonal holds its diagonal
+  /// \post m_values holds the strictly lower part of L~ and m_inverse_diagonal the reciprocal of D^2. Throws error if a pivot is not positive
+  void factor();
+public:
+  //! Constructor
+  /// \pre m is positive definite, and so is its incomplete factorization (true for diagonally dominant m with non-positive off diagonals)
+  /// \post L of m is computed on the non-zero pattern of the band of m. Throws error if a pivot is not positive
+  /// @param m of type const Symmetric_Banded_Matrix<T>&
+  Incomplete_Cholesky(const Symmetric_Banded_Matrix<T>& m);
+  //! Constructor
+  /// \pre None
+  /// \post L of m is computed on the five point pattern of the stencil, in time linear in the size of m
+  /// @param m of type const Poisson_Stencil_Matrix<T>&
+  Incomplete_Cholesky(const Poisson_Stencil_Matrix<T>& m);
+  //! Function Operator
+  /// \pre size of r matches the size of the preconditioner
+  /// \post Returns z of L(L^T)z = r, by forward and backward substitution with L~ over the stored entries. Throws error if the sizes do not match
+  /// @param r of type const Vector<T>&
+  virtual Vector<T> operator()(const Vector<T>& r) const;
+  //! Returns the size of the preconditioner
+  /// \pre None
+  /// \post Returns the number of rows (and cols) of M
+  virtual unsigned int size() const;
+};
+
+#include "incomplete_cholesky.hpp"
+
+#endif
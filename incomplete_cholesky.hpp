@@ -0,0 +1,178 @@
+/**
+ *  @file incomplete_cholesky.hpp
+ *  @brief Class implmentation for incomplete cholesky
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <math.h>
+#include "vector.h"
+#include "DimensionError.h"
+#include "PositiveDefError.h"
+
+template <typename T>
+Incomplete_Cholesky<T>::Incomplete_Cholesky(const Symmetric_Banded_Matrix<T>& m)
+{
+  m_n = m.num_rows();
+  unsigned int band = m.bandwidth();
+  const T* a = m.data();
+
+  //Count the structural non-zeros left of the diagonal, then gather them.
+  //The stored part of row i is contiguous, so the band is read straight
+  //from storage rather than element by element
+  m_row_start = Aligned_Array<unsigned int>(m_n+1);
+  unsigned int* start = m_row_start.data();
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    const T* row = a + (i+1)*band;
+    unsigned int count = 0;
+    for(unsigned int j = (i > band ? i-band : 0); j < i; j++)
+      count += (row[j] != 0);
+    start[i+1] = start[i] + count;
+  }
+  m_cols = Aligned_Array<unsigned int>(start[m_n]);
+  m_values = Aligned_Array<T>(start[m_n]);
+  m_inverse_diagonal = Aligned_Array<T>(m_n);
+  unsigned int* cols = m_cols.data();
+  T* values = m_values.data();
+  T* diagonal = m_inverse_diagonal.data();
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    const T* row = a + (i+1)*band;
+    unsigned int e = start[i];
+    for(unsigned int j = (i > band ? i-band : 0); j < i; j++)
+    {
+      if(row[j] != 0)
+      {
+        cols[e] = j;
+        values[e] = row[j];
+        e++;
+      }
+    }
+    diagonal[i] = row[i];
+  }
+  factor();
+}
+
+template <typename T>
+Incomplete_Cholesky<T>::Incomplete_Cholesky(const Poisson_Stencil_Matrix<T>& m)
+{
+  m_n = m.num_rows();
+  unsigned int side = m.side();
+
+  //Row i of the stencil has the point above it, at i-side, and the point
+  //left of it, at i-1, unless i starts a grid row
+  m_row_start = Aligned_Array<unsigned int>(m_n+1);
+  unsigned int* start = m_row_start.data();
+  for(unsigned int i = 0; i < m_n; i++)
+    start[i+1] = start[i] + (i >= side) + (i % side != 0);
+  m_cols = Aligned_Array<unsigned int>(start[m_n]);
+  m_values = Aligned_Array<T>(start[m_n]);
+  m_inverse_diagonal = Aligned_Array<T>(m_n);
+  unsigned int* cols = m_cols.data();
+  T* values = m_values.data();
+  T* diagonal = m_inverse_diagonal.data();
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    unsigned int e = start[i];
+    if(i >= side)
+    {
+      cols[e] = i-side;
+      values[e++] = static_cast<T>(-0.25);
+    }
+    if(i % side != 0)
+    {
+      cols[e] = i-1;
+      values[e++] = static_cast<T>(-0.25);
+    }
+    diagonal[i] = 1;
+  }
+  factor();
+}
+
+template <typename T>
+void Incomplete_Cholesky<T>::factor()
+{
+  const unsigned int* start = m_row_start.data();
+  const unsigned int* cols = m_cols.data();
+  T* values = m_values.data();
+  T* inverse = m_inverse_diagonal.data();
+
+  //Row by row, L(i, j) = (m(i, j) - sum of L(i, k)L(j, k)) / L(j, j). Only the
+  //k where both rows have an entry contribute, found by merging the rows
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    for(unsigned int e = start[i]; e < start[i+1]; e++)
+    {
+      unsigned int j = cols[e];
+      T sum = 0;
+      unsigned int p = start[i];
+      unsigned int q = start[j];
+      while(p < e && q < start[j+1])
+      {
+        if(cols[p] == cols[q])
+          sum += values[p++]*values[q++];
+        else if(cols[p] < cols[q])
+          p++;
+        else
+          q++;
+      }
+      values[e] = (values[e] - sum) * inverse[j];
+    }
+    T pivot = inverse[i];
+    for(unsigned int e = start[i]; e < start[i+1]; e++)
+      pivot -= values[e]*values[e];
+    if(pivot <= 0)
+      throw PositiveDefError();
+    inverse[i] = static_cast<T>(1 / sqrt(pivot));
+  }
+
+  //Keep L as (L~)D with L~ unit lower, so M = (L~)(D^2)(L~^T). The sweeps then
+  //carry one multiply and subtract per entry, and D^2 is a scaling between them
+  for(unsigned int i = 0; i < m_n; i++)
+    for(unsigned int e = start[i]; e < start[i+1]; e++)
+      values[e] *= inverse[cols[e]];
+  for(unsigned int i = 0; i < m_n; i++)
+    inverse[i] *= inverse[i];
+}
+
+template <typename T>
+Vector<T> Incomplete_Cholesky<T>::operator()(const Vector<T>& r) const
+{
+  if(r.size() != m_n)
+    throw DimensionError(r.size());
+  Vector<T> z(r);
+  T* x = z.data();
+  const unsigned int* start = m_row_start.data();
+  const unsigned int* cols = m_cols.data();
+  const T* values = m_values.data();
+  const T* inverse = m_inverse_diagonal.data();
+
+  //Forward, (L~)w = r using the rows of L~
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    T sum = x[i];
+    for(unsigned int e = start[i]; e < start[i+1]; e++)
+      sum -= values[e]*x[cols[e]];
+    x[i] = sum;
+  }
+
+  for(unsigned int i = 0; i < m_n; i++)
+    x[i] *= inverse[i];
+
+  //Backward, (L~^T)z = (D^-2)w. Row i of L~ is column i of L~^T, so once
+  //z[i] is known it is taken out of the entries it touches
+  for(unsigned int i = m_n; i-- > 0;)
+  {
+    T zi = x[i];
+    for(unsigned int e = start[i]; e < start[i+1]; e++)
+      x[cols[e]] -= values[e]*zi;
+  }
+  return z;
+}
+
+template <typename T>
+unsigned int Incomplete_Cholesky<T>::size() const
+{
+  return m_n;
+}
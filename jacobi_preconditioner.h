@@ -0,0 +1,44 @@
+#ifndef JACOBI_PRECONDITIONER_H
+#define JACOBI_PRECONDITIONER_H
+/**
+ *  @file jacobi_preconditioner.h
+ *  @brief Class defintion for jacobi preconditioner
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "vector.h"
+#include "abstract_matrix.h"
+#include "preconditioner.h"
+
+///
+/// \class Jacobi_Preconditioner
+/// \brief This class is the diagonal (Jacobi) preconditioner, M is the main
+///        diagonal of the system matrix
+///
+
+template <typename T>
+class Jacobi_Preconditioner : public Preconditioner<T>
+{
+private:
+  Vector<T> m_inverse_diagonal; //!< reciprocals of the diagonal of the matrix
+public:
+  //! Constructor
+  /// \pre m is square with no zero on its diagonal
+  /// \post Preconditioner created from the diagonal of m. Throws error if m is not square or has a zero on the diagonal
+  /// @param m of type const Abstract_Matrix<T>&
+  Jacobi_Preconditioner(const Abstract_Matrix<T>& m);
+  //! Function Operator
+  /// \pre size of r matches the size of the preconditioner
+  /// \post Returns r divided element wise by the diagonal. Throws error if the sizes do not match
+  /// @param r of type const Vector<T>&
+  virtual Vector<T> operator()(const Vector<T>& r) const;
+  //! Returns the size of the preconditioner
+  /// \pre None
+  /// \post Returns the number of rows (and cols) of M
+  virtual unsigned int size() const;
+};
+
+#include "jacobi_preconditioner.hpp"
+
+#endif
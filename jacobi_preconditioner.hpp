@@ -0,0 +1,46 @@
+/**
+ *  @file jacobi_preconditioner.hpp
+ *  @brief Class implmentation for jacobi preconditioner
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "vector.h"
+#include "DimensionError.h"
+#include "MatrixDimError.h"
+#include "SingularError.h"
+
+template <typename T>
+Jacobi_Preconditioner<T>::Jacobi_Preconditioner(const Abstract_Matrix<T>& m)
+{
+  if(m.num_rows() != m.num_cols())
+    throw MatrixDimError(m.num_rows(), m.num_cols());
+  m_inverse_diagonal = Vector<T>(m.num_rows());
+  for(unsigned int i = 0; i < m.num_rows(); i++)
+  {
+    T diagonal = m(i, i);
+    if(diagonal == 0)
+      throw SingularError();
+    m_inverse_diagonal[i] = 1/diagonal;
+  }
+}
+
+template <typename T>
+Vector<T> Jacobi_Preconditioner<T>::operator()(const Vector<T>& r) const
+{
+  if(r.size() != m_inverse_diagonal.size())
+    throw DimensionError(r.size());
+  Vector<T> z(r.size());
+  const T* d = m_inverse_diagonal.data();
+  const T* in = r.data();
+  T* out = z.data();
+  for(unsigned int i = 0; i < r.size(); i++)
+    out[i] = d[i]*in[i];
+  return z;
+}
+
+template <typename T>
+unsigned int Jacobi_Preconditioner<T>::size() const
+{
+  return m_inverse_diagonal.size();
+}
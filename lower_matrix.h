@@ -9,7 +9,7 @@
 
 #include "vector.h"
 #include "abstract_matrix.h"
-#include "Array.h"
+#include "Aligned_Array.h"
 
 //forward declare class
 template <typename T>
@@ -29,12 +29,12 @@ class Lower_Matrix : public Abstract_Matrix<T>
 private:
   unsigned int m_n; //!< number of rows and cols of the matrix
   unsigned int m_total_elements; //!< Triangular number to see how many elements are in the
-  Array<T> m_elements; //!< Array holding elements, most efficent way. No wasted space.
+  Aligned_Array<T> m_elements; //!< Array holding elements, most efficent way. No wasted space. Rows are packed one after another
 public:
   //! Default Constructor
   /// \pre None
   /// \post Creates matrix with no elements
-  Lower_Matrix():m_n(0){}
+  Lower_Matrix():m_n(0),m_total_elements(0){}
   //! Constructor
   /// \pre None
   /// \post Creates a n x n Lower Triangle matrix
@@ -103,6 +103,16 @@ public:
   /// \post returns the vector b of Ax = b. Throws error if the size of v is not the same as the number of columns in the matrix
   /// @param v of type const Vector<T>&
   virtual Vector<T> operator*(const Vector<T>& v) const;
+  //! Triangular solve in place
+  /// \pre size of b must be the same as the number of columns in the matrix. The diagonal must not have a zero
+  /// \post b holds the x of Lx = b, found by forward substitution. Throws error if the sizes differ or the matrix is singular
+  /// @param b of type Vector<T>&
+  void solve_in_place(Vector<T>& b) const;
+  //! Transposed triangular solve in place
+  /// \pre size of b must be the same as the number of columns in the matrix. The diagonal must not have a zero
+  /// \post b holds the x of (L^T)x = b, found by backward substitution. Throws error if the sizes differ or the matrix is singular
+  /// @param b of type Vector<T>&
+  void solve_transpose_in_place(Vector<T>& b) const;
   //! Assignment operator
   /// \pre None
   /// \post Calling Object is now equal to m
@@ -6,12 +6,14 @@
 */
 
 #include <utility>
-#include "Array.h"
+#include "Aligned_Array.h"
 #include "vector.h"
 #include "RangeError.h"
 #include "DimensionError.h"
 #include "MatrixDimError.h"
 #include "ModificationError.h"
+#include "SingularError.h"
+#include "vector_kernels.h"
 #include "upper_matrix.h"
 
 template <typename T>
@@ -19,7 +21,7 @@ Lower_Matrix<T>::Lower_Matrix(unsigned int n)
 {
   m_n = n;
   m_total_elements = n*(n+1)/2;
-  m_elements = Array<T>(m_total_elements);
+  m_elements = Aligned_Array<T>(m_total_elements);
 }
 
 template <typename T>
@@ -37,7 +39,7 @@ Lower_Matrix<T>::Lower_Matrix(const Abstract_Matrix<T>& m)
     throw MatrixDimError(m.num_rows(), m.num_cols());
   m_n = m.num_rows();
   m_total_elements = m_n*(m_n+1)/2;
-  m_elements = Array<T>(m_total_elements);
+  m_elements = Aligned_Array<T>(m_total_elements);
   int counter = 0;
   for(unsigned int i = 0; i < m.num_rows(); i++)
   {
@@ -47,7 +49,7 @@ Lower_Matrix<T>::Lower_Matrix(const Abstract_Matrix<T>& m)
         throw ModificationError();
       if(i >= j)
       {
-        m_elements[i] = m(i,j);
+        m_elements[counter] = m(i,j);
         counter++;
       }
     }
@@ -58,7 +60,7 @@ template <typename T>
 Lower_Matrix<T>::Lower_Matrix(Lower_Matrix<T>&& m)
 {
   m_n = std::move(m.m_n);
-  m_total_elements = std::move(m.m_n);
+  m_total_elements = std::move(m.m_total_elements);
   m_elements = std::move(m.m_elements);
 }
 
@@ -183,16 +185,50 @@ Vector<T> Lower_Matrix<T>::operator*(const Vector<T>& v) const
   if(m_n != v.size())
     throw MatrixDimError(m_n, m_n);
   Vector<T> temp(m_n);
-  for(unsigned int j = 0; j < m_n; j++)
+  //Row i is packed as (i, 0..i), so every entry is a dot product over one contiguous run
+  const T* row = m_elements.data();
+  for(unsigned int i = 0; i < m_n; i++)
   {
-    for(unsigned int i = j; i < m_n; i++)
-    {
-      temp[i] += operator()(i, j)*v[j];
-    }
+    temp[i] = static_cast<T>(Vector_Kernels<T>::dot(row, v.data(), i+1));
+    row += i+1;
   }
   return temp;
 }
 
+template <typename T>
+void Lower_Matrix<T>::solve_in_place(Vector<T>& b) const
+{
+  if(m_n != b.size())
+    throw DimensionError(b.size());
+  T* x = b.data();
+  const T* row = m_elements.data();
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    if(row[i] == 0)
+      throw SingularError();
+    x[i] = (x[i] - static_cast<T>(Vector_Kernels<T>::dot(row, x, i))) / row[i];
+    row += i+1;
+  }
+}
+
+template <typename T>
+void Lower_Matrix<T>::solve_transpose_in_place(Vector<T>& b) const
+{
+  if(m_n != b.size())
+    throw DimensionError(b.size());
+  T* x = b.data();
+  //Row i of L is column i of L^T, so once x[i] is known it is taken out of
+  //the entries above it with one axpy over the packed row
+  for(unsigned int i = m_n; i-- > 0;)
+  {
+    const T* row = m_elements.data() + i*(i+1)/2;
+    if(row[i] == 0)
+      throw SingularError();
+    x[i] /= row[i];
+    Vector_Kernels<T>::axpy(-x[i], row, x, i);
+  }
+}
+
 template <typename T>
 Lower_Matrix<T>& Lower_Matrix<T>::operator=(Lower_Matrix<T> m)
 {
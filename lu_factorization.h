@@ -0,0 +1,72 @@
+#ifndef LU_FACTORIZATION_H
+#define LU_FACTORIZATION_H
+
+/**
+ *  @file lu_factorization.h
+ *  @brief Class defintion for lu factorization
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "abstract_matrix.h"
+#include "matrix.h"
+#include "vector.h"
+#include "Array.h"
+
+///
+/// \class LU_Factorization
+/// \brief This class is the LU factorization from gaussian elimination with
+///        scaled partial pivoting. The factorization is blocked and right
+///        looking: a panel of BLOCK columns is eliminated with pivoting, the
+///        rows of the upper factor to its right are solved, and the rest of
+///        the matrix takes the product of the two as one Gemm update, split
+///        into bands of rows on the shared Thread_Pool. Pivot rows are
+///        swapped in place, and the order of the original rows is kept in a
+///        pivot array. Both are reused by every solve.
+///
+
+template <typename T>
+class LU_Factorization
+{
+private:
+  unsigned int m_n; //!< number of rows and cols of the factored matrix, 0 before factor() is called
+  Matrix<T> m_factors; //!< row i holds the multipliers in columns 0..i-1 and the upper factor in columns i..n-1
+  Array<unsigned int> m_pivots; //!< original row of each row of m_factors
+  static const unsigned int BLOCK = 64; //!< columns in a panel, the depth of the trailing update
+  //! Eliminates a panel
+  /// \pre a is n x n with row stride stride, columns 0..first-1 are factored and the updates from them applied. scale and order hold the scale and original index of each row
+  /// \post Columns first to first+width-1 hold their multipliers and their part of the upper factor. Whole rows are swapped for the pivots, with scale and order. Throws error if a pivot or a scale is under tolerance
+  static void factor_panel(T* a, unsigned int stride, unsigned int n, unsigned int first, unsigned int width, Array<double>& scale, Array<unsigned int>& order, double tolerance);
+  //! Updates the matrix right of a panel
+  /// \pre The panel of columns first to first+width-1 of a has been eliminated
+  /// \post Rows first to first+width-1 right of the panel hold the upper factor, and the rows below them have taken the update from the panel
+  static void update_trailing(T* a, unsigned int stride, unsigned int n, unsigned int first, unsigned int width);
+public:
+  //! Constructor
+  /// \pre None
+  /// \post LU object created, with no factor
+  LU_Factorization():m_n(0){}
+  //! Factorization
+  /// \pre m must be square and nonsingular
+  /// \post The calling object holds the factors of m and the pivot order. Throws error if m is not square or is singular
+  /// @param m of type const Abstract_Matrix<T>&
+  void factor(const Abstract_Matrix<T>& m);
+  //! Solve with the kept factors
+  /// \pre factor() has been called. The size of b matches the rows of the factored matrix
+  /// \post Returns x of mx = b. Throws error if the sizes do not match
+  /// @param b of type const Vector<T>&
+  Vector<T> solve(const Vector<T>& b) const;
+  //! Solve for many right hand sides with the kept factors
+  /// \pre factor() has been called. B has as many rows as the factored matrix, each column is a right hand side
+  /// \post Returns X of mX = B. The sweeps run over whole rows of B, so all the right hand sides are solved together. Throws error if the rows of B do not match
+  /// @param B of type const Matrix<T>&
+  Matrix<T> solve(const Matrix<T>& B) const;
+  //! Return the number of rows in the factored matrix
+  /// \pre None
+  /// \post Returns the number of rows in the factored matrix, 0 if nothing has been factored
+  unsigned int size() const;
+};
+
+#include "lu_factorization.hpp"
+
+#endif
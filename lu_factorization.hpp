@@ -0,0 +1,213 @@
+/**
+ *  @file lu_factorization.hpp
+ *  @brief Class implmentation for lu factorization
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <math.h>
+#include <algorithm>
+#include "abstract_matrix.h"
+#include "matrix.h"
+#include "vector.h"
+#include "Array.h"
+#include "SingularError.h"
+#include "MatrixDimError.h"
+#include "DimensionError.h"
+#include "vector_kernels.h"
+#include "thread_pool.h"
+#include "gemm.h"
+#include "Aligned_Array.h"
+
+//Definition for the block size, it is bound to a reference by std::min
+template <typename T>
+const unsigned int LU_Factorization<T>::BLOCK;
+
+template <typename T>
+void LU_Factorization<T>::factor_panel(T* a, unsigned int stride, unsigned int n, unsigned int first, unsigned int width,
+                                       Array<double>& scale, Array<unsigned int>& order, double tolerance)
+{
+  unsigned int end = first+width;
+  //The last column has nothing below it to eliminate
+  for(unsigned int k = first; k < end && k+1 < n; k++)
+  {
+    //choose pivot equation
+    double rmax = 0;
+    unsigned int p = k;
+    for(unsigned int i = k; i < n; i++)
+    {
+      double r = fabs(a[i*stride+k] / scale[i]);
+      if(r > rmax)
+      {
+        rmax = r;
+        p = i;
+      }
+    }
+    //interchange the rows themselves, so every later access is direct
+    if(p != k)
+    {
+      std::swap_ranges(a+k*stride, a+k*stride+n, a+p*stride);
+      std::swap(scale[k], scale[p]);
+      std::swap(order[k], order[p]);
+    }
+    const T* pivot_row = a+k*stride;
+    if(fabs(pivot_row[k]) < tolerance)
+      throw SingularError();
+
+    //Eliminate inside the panel only, the rest of the row waits for the
+    //trailing update
+    Thread_Pool::shared().parallel_for(k+1, n, Thread_Pool::grain(end-k), [a, stride, pivot_row, k, end](unsigned int from, unsigned int to)
+    {
+      for(unsigned int i = from; i < to; i++)
+      {
+        T* row = a+i*stride;
+        double xmult = row[k] / pivot_row[k];
+        row[k] = static_cast<T>(xmult);
+        Vector_Kernels<T>::axpy(static_cast<T>(-xmult), pivot_row+k+1, row+k+1, end-k-1);
+      }
+    });
+  }
+}
+
+template <typename T>
+void LU_Factorization<T>::update_trailing(T* a, unsigned int stride, unsigned int n, unsigned int first, unsigned int width)
+{
+  unsigned int end = first+width;
+  unsigned int rest = n-end;
+  Thread_Pool& pool = Thread_Pool::shared();
+
+  //Rows of the upper factor right of the panel, forward substitution with
+  //the unit lower triangle of the panel. Columns are independent, so bands
+  //of them go to the pool
+  pool.parallel_for(0, rest, Thread_Pool::grain(width*width/2), [a, stride, first, width, end](unsigned int from, unsigned int to)
+  {
+    for(unsigned int r = 1; r < width; r++)
+    {
+      T* row = a+(first+r)*stride;
+      for(unsigned int j = 0; j < r; j++)
+        Vector_Kernels<T>::axpy(-row[first+j], a+(first+j)*stride+end+from, row+end+from, to-from);
+    }
+  });
+
+  //Gemm adds its product, so the rows of the upper factor are negated
+  //once for every band
+  Aligned_Array<T> negated(width*rest);
+  for(unsigned int r = 0; r < width; r++)
+  {
+    const T* row = a+(first+r)*stride+end;
+    for(unsigned int c = 0; c < rest; c++)
+      negated[r*rest+c] = -row[c];
+  }
+  const T* upper = negated.data();
+  pool.parallel_for(end, n, BLOCK, [a, stride, first, width, end, rest, upper](unsigned int from, unsigned int to)
+  {
+    Gemm<T>()(to-from, rest, width, a+from*stride+first, stride, upper, rest, a+from*stride+end, stride);
+  });
+}
+
+template <typename T>
+void LU_Factorization<T>::factor(const Abstract_Matrix<T>& A)
+{
+  if(A.num_rows() != A.num_cols())
+    throw MatrixDimError(A.num_rows(), A.num_cols());
+  Matrix<T> matrix(A);
+  unsigned int n = matrix.num_rows(); // n x n matrix
+  T* a = matrix.data();
+  unsigned int stride = matrix.stride();
+  Array<double> s(n); //need n spots for row maximums
+  Array<unsigned int> l(n);
+  double tolerance = 0.005;
+
+  //Scalding vector
+  for(unsigned int i = 0; i < n; i++)
+  {
+    l[i] = i;
+    double smax = 0;
+    for(unsigned int j = 0; j < n; j++)
+      smax = std::max(smax, static_cast<double>(fabs(a[i*stride+j])));
+    s[i] = smax;
+    //A row with nothing in it makes the matrix singular
+    if(n > 1 && fabs(s[i]) < tolerance)
+      throw SingularError();
+  }
+
+  //steps, a panel at a time
+  for(unsigned int first = 0; first < n; first += BLOCK)
+  {
+    unsigned int width = std::min(BLOCK, n-first);
+    factor_panel(a, stride, n, first, width, s, l, tolerance);
+    if(first+width < n)
+      update_trailing(a, stride, n, first, width);
+  }
+  if(n > 0 && fabs(a[(n-1)*stride+n-1]) < tolerance)
+    throw SingularError();
+
+  m_factors = std::move(matrix);
+  m_pivots = l;
+  m_n = n;
+}
+
+template <typename T>
+Vector<T> LU_Factorization<T>::solve(const Vector<T>& b) const
+{
+  if(b.size() != m_n)
+    throw DimensionError(m_n);
+  int n = m_n;
+  int i;
+  Vector<T> x(n);
+
+  //Start forward elimination. Row i holds the multipliers of the unit
+  //lower factor in columns 0..i-1, so each step is one dot product over the row
+  Vector<T> y(n);
+  for(i = 0; i < n; i++)
+    y[i] = b[m_pivots[i]] - static_cast<T>(Vector_Kernels<T>::dot(m_factors[i].data(), y.data(), i));
+
+  //Start backwards solving, the upper factor is in columns i..n-1 of row i
+  for(i = n-1; i >= 0; i--)
+  {
+    const T* row = m_factors[i].data();
+    x[i] = (y[i] - static_cast<T>(Vector_Kernels<T>::dot(row+i+1, x.data()+i+1, n-i-1))) / row[i];
+  }
+
+  return x;
+}
+
+template <typename T>
+Matrix<T> LU_Factorization<T>::solve(const Matrix<T>& B) const
+{
+  if(B.num_rows() != m_n)
+    throw DimensionError(m_n);
+  int n = m_n;
+  unsigned int rhs = B.num_cols();
+  Matrix<T> X(n, rhs);
+
+  //Forward, row i of Y is row l[i] of B less the multipliers times the rows
+  //of Y above it, each update an axpy across all of the right hand sides
+  for(int i = 0; i < n; i++)
+  {
+    T* xi = X[i].data();
+    const T* bi = B[m_pivots[i]].data();
+    std::copy(bi, bi+rhs, xi);
+    const T* row = m_factors[i].data();
+    for(int j = 0; j < i; j++)
+      Vector_Kernels<T>::axpy(-row[j], X[j].data(), xi, rhs);
+  }
+
+  //Backwards, row i of X is solved from the rows below it
+  for(int i = n-1; i >= 0; i--)
+  {
+    T* xi = X[i].data();
+    const T* row = m_factors[i].data();
+    for(int j = i+1; j < n; j++)
+      Vector_Kernels<T>::axpy(-row[j], X[j].data(), xi, rhs);
+    Vector_Kernels<T>::scale(xi, 1/row[i], xi, rhs);
+  }
+
+  return X;
+}
+
+template <typename T>
+unsigned int LU_Factorization<T>::size() const
+{
+  return m_n;
+}
@@ -20,9 +20,11 @@
 #include "symmetric_matrix.h"
 #include "cholesky.h"
 #include "DomainError.h"
+#include "ConvergenceError.h"
 //#include "function.h"
 #include "FiniteDiff.h"
-#include <time.h>
+#include "thread_pool.h"
+#include <chrono>
 
 //Obtain math constants
 /*! A constant for the tolerance of a double */
@@ -54,6 +56,20 @@ double BCfunc(double x, double y)
   return value;
 }
 
+///
+/// \fn long long elapsedMs(chrono::steady_clock::time_point start)
+/// \brief This function measures the wall clock time since start. The solvers
+///        run on several threads, and clock() would add up the time of all of them
+/// \pre none
+/// \post The milliseconds passed since start are returned
+/// \returns the wall clock time since start in milliseconds
+///
+
+long long elapsedMs(chrono::steady_clock::time_point start)
+{
+  return static_cast<long long>(chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now()-start).count());
+}
+
 /*! A pointer to a function that takes 2 doubles and returns a double */
 typedef double(*funcPtr)(double, double);
 
@@ -62,7 +78,9 @@ typedef double(*funcPtr)(double, double);
 /// \pre none
 /// \post the program has completed
 /// \param argc is the number of arguments in the command line
-/// \param argv is an array containing the arguments from the command line
+/// \param argv is an array containing the arguments from the command line,
+///        the number of divisions followed by -t threads to size the thread
+///        pool and -d for deterministic reductions
 ///
 
 int main(int argc, char** argv)
@@ -70,9 +88,27 @@ int main(int argc, char** argv)
   try
   {
 
-    if(argc != 2)
+    //Optional flags after n override POOL_THREADS and POOL_DETERMINISTIC
+    bool valid = (argc >= 2);
+    int threads = 0;
+    bool deterministic = false;
+    for(int i = 2; i < argc && valid; i++)
+    {
+      string flag(argv[i]);
+      if(flag == "-t" && i+1 < argc)
+      {
+        threads = stoi(argv[++i]);
+        valid = (threads > 0);
+      }
+      else if(flag == "-d")
+        deterministic = true;
+      else
+        valid = false;
+    }
+    if(!valid)
     {
-      cerr << "Invalid Paramaters. Please use \"./driver n\" where n is a positive integer." << endl;
+      cerr << "Invalid Paramaters. Please use \"./driver n [-t threads] [-d]\" where n and threads are positive integers"
+           << " and -d makes reductions deterministic." << endl;
       return 1;
     }
     int divs = stoi(argv[1]);
@@ -81,26 +117,70 @@ int main(int argc, char** argv)
       cerr << "Number of divisions must be positive" << endl;
       return 1;
     }
-
-    clock_t clock1;
-    clock_t clock2;
+    if(threads > 0)
+      Thread_Pool::configure(threads);
+    if(deterministic)
+      Thread_Pool::shared().set_deterministic(true);
+
+    chrono::steady_clock::time_point clock1;
+    chrono::steady_clock::time_point clock2;
+    chrono::steady_clock::time_point clock3;
+    chrono::steady_clock::time_point clock4;
+    chrono::steady_clock::time_point clock5;
+    chrono::steady_clock::time_point clock6;
+    chrono::steady_clock::time_point clock7;
+    chrono::steady_clock::time_point clock8;
 
     FiniteDiff<double, BCfunc> solver(divs);
 
     //--- Gaussian Partial Pivoting ---
-    clock1=clock();
+    clock1=chrono::steady_clock::now();
     cout << "Guassian Partial Pivoting Solution: " << endl;
     solver.doGauss();
-    clock1=clock()-clock1;
-    cout << "Time Taken: " << (1000*clock1)/CLOCKS_PER_SEC << " ms." << endl;
+    cout << "Time Taken: " << elapsedMs(clock1) << " ms." << endl;
     // --- end Guassian Partial Pivoting ---
 
     // --- Cholesky Decomposition ---
-    clock2=clock();
+    clock2=chrono::steady_clock::now();
     cout << "\n\nCholesky Decomposition Solution: " << endl;
     solver.doCholesky();
-    clock2=clock()-clock2;
-    cout << "Time Taken: " << (1000*clock2)/CLOCKS_PER_SEC << " ms." << endl;
+    cout << "Time Taken: " << elapsedMs(clock2) << " ms." << endl;
+
+    // --- Conjugate Gradient ---
+    clock3=chrono::steady_clock::now();
+    cout << "\n\nConjugate Gradient Solution: " << endl;
+    solver.doCG(1.0E-12);
+    cout << "Time Taken: " << elapsedMs(clock3) << " ms." << endl;
+
+    // --- Preconditioned Conjugate Gradient ---
+    clock4=chrono::steady_clock::now();
+    cout << "\n\nIncomplete Cholesky Preconditioned Conjugate Gradient Solution: " << endl;
+    solver.doPCG(1.0E-12);
+    cout << "Time Taken: " << elapsedMs(clock4) << " ms." << endl;
+
+    // --- Multigrid ---
+    clock5=chrono::steady_clock::now();
+    cout << "\n\nMultigrid Solution: " << endl;
+    solver.doMultigrid(1.0E-12);
+    cout << "Time Taken: " << elapsedMs(clock5) << " ms." << endl;
+
+    // --- Fast Poisson (Sine Transform) ---
+    clock6=chrono::steady_clock::now();
+    cout << "\n\nSine Transform Solution: " << endl;
+    solver.doFastPoisson();
+    cout << "Time Taken: " << elapsedMs(clock6) << " ms." << endl;
+
+    // --- Red-Black SOR ---
+    clock7=chrono::steady_clock::now();
+    cout << "\n\nRed-Black SOR Solution: " << endl;
+    solver.doSOR(1.0E-12);
+    cout << "Time Taken: " << elapsedMs(clock7) << " ms." << endl;
+
+    // --- Sparse Cholesky ---
+    clock8=chrono::steady_clock::now();
+    cout << "\n\nSparse Cholesky Solution: " << endl;
+    solver.doSparseCholesky();
+    cout << "Time Taken: " << elapsedMs(clock8) << " ms." << endl;
 
     //solver.tupleOutput();
 
@@ -136,6 +216,10 @@ int main(int argc, char** argv)
   {
     cerr << "Input outside the domain of the function" << endl;
   }
+  catch(ConvergenceError e)
+  {
+    cerr << "Error: Iterative method did not converge within its iteration limit" << endl;
+  }
   catch(...)
   {
     cerr << "Default Exception" << endl;
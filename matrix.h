@@ -10,7 +10,8 @@
 
 #include "vector.h"
 #include "abstract_matrix.h"
-#include "Array.h"
+#include "Aligned_Array.h"
+#include "matrix_row.h"
 
 //Forward declare classes
 template <typename T>
@@ -21,7 +22,9 @@ class Lower_Matrix;
 
 ///
 /// \class Matrix
-/// \brief This class acts as 2D matrix
+/// \brief This class acts as 2D matrix. The elements are stored row by row in
+///        one contiguous aligned block, each row starting stride() elements
+///        after the previous one
 ///
 
 template <typename T>
@@ -30,12 +33,27 @@ class Matrix : public Abstract_Matrix<T>
 private:
   unsigned int m_rows; //!< number of rows for the matrix
   unsigned int m_cols; //!< number of columns for the matrix
-  Array<Vector<T>> m_row_vectors; //!< Array of row vectors
+  unsigned int m_stride; //!< distance between the starts of two rows, m_cols padded to a whole number of cache lines
+  Aligned_Array<T> m_elements; //!< Row major array of elements
+  static const unsigned int PRODUCT_ROWS = 192; //!< rows of one tile of a product, two row blocks of Gemm
+  static const unsigned int PRODUCT_COLS = 1024; //!< columns of one tile of a product, whole pages of doubles
+  //! Constructor that may leave the elements unset
+  /// \pre None
+  /// \post Matrix of rows x cols is constructed, with every element zero if initialize is true and unset otherwise
+  /// @param rows of type unsigned int
+  /// @param cols of type unsigned int
+  /// @param initialize of type bool
+  Matrix(unsigned int rows, unsigned int cols, bool initialize);
+  //! Computes the row stride for a number of columns
+  /// \pre None
+  /// \post Returns cols rounded up so that every row starts on an ARRAY_ALIGNMENT boundary, or cols if T does not divide the alignment
+  /// @param cols of type unsigned int
+  static unsigned int stride_for(unsigned int cols);
 public:
   //! Default Constructor
   /// \pre None
   /// \post Matrix of 0 x 0 is constructed
-  Matrix():m_rows(0), m_cols(0){}
+  Matrix():m_rows(0), m_cols(0), m_stride(0){}
   //! Constructor with integer parameters
   /// \pre None
   /// \post Matrix of rows x cols is constructed
@@ -59,14 +77,14 @@ public:
   Matrix(const Abstract_Matrix<T>& m);
   //! indexing operator
   /// \pre index satisfies 0 <= index < m_rows
-  /// \post retuns the row vector at index. Throws error if inequality isn't satisfied
+  /// \post retuns a view of the row at index. Throws error if inequality isn't satisfied
   /// @param index of type unsigned int
-  Vector<T>& operator[](unsigned int index);
+  Matrix_Row<T> operator[](unsigned int index);
   //! constant indexing operator
   /// \pre index satisfies 0 <= index < m_rows
-  /// \post returns constant reference to row vector at index. Throws error if the inequality isn't satisfied
+  /// \post returns a constant view of the row at index. Throws error if the inequality isn't satisfied
   /// @param index of type unsigned integer
-  const Vector<T>& operator[](unsigned int index) const;
+  Matrix_Row<const T> operator[](unsigned int index) const;
   //! Matrix addition
   /// \pre Calling object must have same dimensions as m. Operator+ (T+T) must be defined for type T
   /// \post Returns matrix with the element wise sum. Throws error if Calling Object is not the same dimensions as m
@@ -88,7 +106,7 @@ public:
   Matrix<T> operator*(double factor) const;
   //! Matrix multiplcation
   /// \pre Operator* (T*T) must be defined. The calling object must have the same number of columns as the number of rows in m.
-  /// \post Return the result of standard matrix multiplcaiton, of dimensions m_rows x m.m_cols. Throws error if m_rows != m.m_cols
+  /// \post Return the result of standard matrix multiplcaiton, of dimensions m_rows x m.m_cols. Bands of rows of the result are computed by Gemm on the shared pool. Throws error if m_rows != m.m_cols
   /// @param m of type const Matrix<T>&
   virtual Matrix<T> operator*(const Abstract_Matrix<T>& m) const;
   //! Matrix Transpose
@@ -97,7 +115,7 @@ public:
   Matrix<T> transpose() const;
   //! Matrix multiplcaiton with a vector
   /// \pre v is a column vector of dimension m_rows
-  /// \post return the vector that result from matrix multiplcaiton. Throws error if v is not of size m_rows
+  /// \post return the vector that result from matrix multiplcaiton, with bands of rows on the shared pool. Throws error if v is not of size m_rows
   /// @param v of type const Vector<T>&
   virtual Vector<T> operator*(const Vector<T>& v) const;
   //! Assignment Operator
@@ -129,6 +147,18 @@ public:
   /// \pre None
   /// \post Returns number of cols in matrix
   virtual unsigned int num_cols() const;
+  //! Returns the row stride of the storage
+  /// \pre None
+  /// \post Returns the number of elements between the start of one row and the start of the next
+  unsigned int stride() const;
+  //! Raw pointer to the elements
+  /// \pre None
+  /// \post Returns pointer to element (0, 0). Element (i, j) is at offset i*stride()+j. No range checking is done through it
+  T* data();
+  //! Raw pointer to the elements (calling object not mutable in this version)
+  /// \pre None
+  /// \post Returns const pointer to element (0, 0). Element (i, j) is at offset i*stride()+j. No range checking is done through it
+  const T* data() const;
   //! Get element operator
   /// \pre row satisfies 0<=row<M_rows and col satisfies 0<=col<m_cols
   /// \post Returns reference to element. Throws error if any inequality in the pre condition is not satisfied
@@ -159,7 +189,8 @@ public:
   {
     std::swap(m1.m_rows, m2.m_rows);
     std::swap(m1.m_cols, m2.m_cols);
-    std::swap(m1.m_row_vectors, m2.m_row_vectors);
+    std::swap(m1.m_stride, m2.m_stride);
+    std::swap(m1.m_elements, m2.m_elements);
     return;
   }
   //! extration operator
@@ -171,7 +202,7 @@ public:
   {
     for(unsigned int i = 0; i < m.m_rows; i++)
     {
-      os << m.m_row_vectors[i] << std::endl;
+      os << m[i] << std::endl;
     }
     return os;
   }
@@ -186,7 +217,7 @@ public:
     {
       if(!in || in.eof())
         throw InputError();
-      in >> m.m_row_vectors[i];
+      in >> m[i];
     }
     return in;
   }
@@ -6,24 +6,43 @@
 */
 
 #include <utility>
-#include "Array.h"
+#include <algorithm>
+#include "Aligned_Array.h"
+#include "matrix_row.h"
 #include "vector.h"
 #include "RangeError.h"
 #include "DimensionError.h"
 #include "MatrixDimError.h"
+#include "gemm.h"
+#include "vector_kernels.h"
+#include "thread_pool.h"
+
+template <typename T>
+unsigned int Matrix<T>::stride_for(unsigned int cols)
+{
+  if(ARRAY_ALIGNMENT % sizeof(T) != 0)
+    return cols;
+  const unsigned int per_line = ARRAY_ALIGNMENT/sizeof(T);
+  return (cols+per_line-1)/per_line*per_line;
+}
 
 template <typename T>
 Matrix<T>::Matrix(unsigned int rows, unsigned int cols)
 {
   m_rows = rows;
   m_cols = cols;
-  m_row_vectors = Array<Vector<T>>(m_rows);
+  m_stride = stride_for(m_cols);
+  //One allocation for the whole matrix, value initialized
+  m_elements = Aligned_Array<T>(m_rows*m_stride);
+}
 
-  //Vectors must be initalized seperatly
-  for(unsigned int i = 0; i < m_rows; i++)
-  {
-    m_row_vectors[i] = Vector<T>(m_cols);
-  }
+template <typename T>
+Matrix<T>::Matrix(unsigned int rows, unsigned int cols, bool initialize)
+{
+  m_rows = rows;
+  m_cols = cols;
+  m_stride = stride_for(m_cols);
+  m_elements = Aligned_Array<T>(m_rows*m_stride, initialize);
 }
 
 template <typename T>
@@ -31,7 +50,8 @@ Matrix<T>::Matrix(Matrix<T>&& m)
 {
   m_rows = std::move(m.m_rows);
   m_cols = std::move(m.m_cols);
-  m_row_vectors = std::move(m.m_row_vectors);
+  m_stride = std::move(m.m_stride);
+  m_elements = std::move(m.m_elements);
 }
 
 template <typename T>
@@ -39,7 +59,8 @@ Matrix<T>::Matrix(const Matrix<T>& m)
 {
   m_rows = m.m_rows;
   m_cols = m.m_cols;
-  m_row_vectors = m.m_row_vectors;
+  m_stride = m.m_stride;
+  m_elements = m.m_elements;
 }
 
 template <typename T>
@@ -47,31 +68,32 @@ Matrix<T>::Matrix(const Abstract_Matrix<T>& m)
 {
   m_rows = m.num_rows();
   m_cols = m.num_cols();
-  m_row_vectors = Array<Vector<T>>(m_rows);
+  m_stride = stride_for(m_cols);
+  m_elements = Aligned_Array<T>(m_rows*m_stride);
+  T* a = m_elements.data();
   for(unsigned int i = 0; i < m_rows; i++)
   {
-    m_row_vectors[i] = Vector<T>(m_cols);
     for(unsigned int j = 0; j < m_cols; j++)
     {
-      m_row_vectors[i][j] = m(i, j);
+      a[i*m_stride+j] = m(i, j);
     }
   }
 }
 
 template <typename T>
-Vector<T>& Matrix<T>::operator[](unsigned int index)
+Matrix_Row<T> Matrix<T>::operator[](unsigned int index)
 {
-  if(!(index >= 0 && index < m_row_vectors.size()))
+  if(index >= m_rows)
     throw RangeError(index);
-  return m_row_vectors[index];
+  return Matrix_Row<T>(m_elements.data()+index*m_stride, m_cols);
 }
 
 template <typename T>
-const Vector<T>& Matrix<T>::operator[](unsigned int index) const
+Matrix_Row<const T> Matrix<T>::operator[](unsigned int index) const
 {
-  if(!(index >= 0 && index < m_row_vectors.size()))
+  if(index >= m_rows)
     throw RangeError(index);
-  return m_row_vectors[index];
+  return Matrix_Row<const T>(m_elements.data()+index*m_stride, m_cols);
 }
 
 template <typename T>
@@ -80,11 +102,13 @@ Matrix<T> Matrix<T>::operator+(const Abstract_Matrix<T>& m) const
   if(m_rows != m.num_rows() || m_cols != m.num_cols())
     throw MatrixDimError(m_rows, m_cols);
   Matrix<T> result(m_rows, m_cols);
+  const T* a = m_elements.data();
+  T* c = result.m_elements.data();
   for(unsigned int i = 0; i < m_rows; i++)
   {
     for(unsigned int j = 0; j < m_cols; j++)
     {
-      result[i][j] = m_row_vectors[i][j] + m(i, j);
+      c[i*m_stride+j] = a[i*m_stride+j] + m(i, j);
     }
   }
   return result;
@@ -96,11 +120,13 @@ Matrix<T> Matrix<T>::operator-(const Abstract_Matrix<T>& m) const
   if(m_rows != m.num_rows() || m_cols != m.num_cols())
     throw MatrixDimError(m_rows, m_cols);
   Matrix<T> result(m_rows, m_cols);
+  const T* a = m_elements.data();
+  T* c = result.m_elements.data();
   for(unsigned int i = 0; i < m_rows; i++)
   {
     for(unsigned int j = 0; j < m_cols; j++)
     {
-      result[i][j] = m_row_vectors[i][j] - m(i, j);
+      c[i*m_stride+j] = a[i*m_stride+j] - m(i, j);
     }
   }
   return result;
@@ -111,7 +137,7 @@ Matrix<T> Matrix<T>::operator-() const
 {
   Matrix<T> result(m_rows, m_cols);
   for(unsigned int i = 0; i < m_rows; i++)
-    result[i] = -m_row_vectors[i];
+    result[i] = -Vector<T>((*this)[i]);
   return result;
 }
 
@@ -119,8 +145,11 @@ template <typename T>
 Matrix<T> Matrix<T>::operator*(double factor) const
 {
   Matrix<T> result(m_rows, m_cols);
+  const T* a = m_elements.data();
+  T* c = result.m_elements.data();
   for(unsigned int i = 0; i < m_rows; i++)
-    result[i] = m_row_vectors[i]*factor;
+    for(unsigned int j = 0; j < m_cols; j++)
+      c[i*m_stride+j] = a[i*m_stride+j]*factor;
   return result;
 }
 
@@ -128,31 +157,36 @@ template <typename T>
 Matrix<T> Matrix<T>::transpose() const
 {
   Matrix<T> result(m_cols, m_rows);
-  for(unsigned int i = 0; i < m_cols; i++)
-    result[i] = col_vector(i);
+  const T* a = m_elements.data();
+  T* c = result.m_elements.data();
+  for(unsigned int i = 0; i < m_rows; i++)
+    for(unsigned int j = 0; j < m_cols; j++)
+      c[j*result.m_stride+i] = a[i*m_stride+j];
   return result;
 }
 
 template <typename T>
 Vector<T> Matrix<T>::col_vector(unsigned int index) const
 {
-  if(!(index >= 0 && index < m_cols))
+  if(index >= m_cols)
     throw RangeError(index);
   Vector<T> result(m_rows);
+  const T* a = m_elements.data();
   for(unsigned int i = 0; i < m_rows; i++)
-    result[i] = m_row_vectors[i][index];
+    result[i] = a[i*m_stride+index];
   return result;
 }
 
 template <typename T>
 void Matrix<T>::set_col(unsigned int index, const Vector<T>& v)
 {
-  if(!(index >= 0 && index < m_cols))
+  if(index >= m_cols)
     throw RangeError(index);
   if(v.size() != m_rows)
     throw DimensionError(v.size());
+  T* a = m_elements.data();
   for(unsigned int i = 0; i < m_rows; i++)
-    m_row_vectors[i][index] = v[i];
+    a[i*m_stride+index] = v[i];
 }
 
 template <typename T>
@@ -160,27 +194,65 @@ Matrix<T> Matrix<T>::operator*(const Abstract_Matrix<T>& m) const
 {
   if(m_cols != m.num_rows())
     throw MatrixDimError(m.num_rows(), m_cols);
-  Matrix<T> result(m_rows, m.num_cols());
-  for(unsigned int i = 0; i < m_rows; i++)
+  //The result is left unset here so that each of its tiles is first
+  //written by the thread computing it, which places the pages of the tile
+  //in the memory next to that thread on hosts with several sockets
+  Matrix<T> result(m_rows, m.num_cols(), false);
+  //Any other kind of matrix is copied to dense storage once, which is
+  //cheap next to the product itself
+  const Matrix<T>* dense = dynamic_cast<const Matrix<T>*>(&m);
+  Matrix<T> temp;
+  if(dense == nullptr)
   {
-    for(unsigned int k = 0; k < m.num_cols(); k++)
+    temp = Matrix<T>(m);
+    dense = &temp;
+  }
+  const T* a = m_elements.data();
+  const T* b = dense->m_elements.data();
+  T* c = result.m_elements.data();
+  unsigned int n = dense->m_cols;
+  unsigned int ldb = dense->m_stride;
+  unsigned int ldc = result.m_stride;
+  unsigned int row_tiles = (m_rows+PRODUCT_ROWS-1)/PRODUCT_ROWS;
+  unsigned int col_tiles = (n+PRODUCT_COLS-1)/PRODUCT_COLS;
+  if(col_tiles == 0)
+    col_tiles = 1;
+  //Tiles are numbered along each band of rows, so a task given a run of
+  //neighbouring tiles reuses the same rows of a
+  Thread_Pool::shared().parallel_for(0, row_tiles*col_tiles, 1, [this, a, b, c, n, ldb, ldc, col_tiles](unsigned int first, unsigned int last)
+  {
+    for(unsigned int t = first; t < last; t++)
     {
-      //std::cout << m.col_vector(k) << std::endl;
-      result.get_elem(i, k) = m_row_vectors[i]*m.col_vector(k);
+      unsigned int r0 = (t/col_tiles)*PRODUCT_ROWS;
+      unsigned int r1 = std::min(r0+PRODUCT_ROWS, m_rows);
+      unsigned int c0 = (t%col_tiles)*PRODUCT_COLS;
+      unsigned int c1 = std::min(c0+PRODUCT_COLS, n);
+      //The last tile of a band also owns the padding at the end of its rows
+      unsigned int end = (c1 == n ? ldc : c1);
+      for(unsigned int i = r0; i < r1; i++)
+        std::fill(c+i*ldc+c0, c+i*ldc+end, T());
+      if(m_cols > 0 && c1 > c0)
+        Gemm<T>()(r1-r0, c1-c0, m_cols, a+r0*m_stride, m_stride, b+c0, ldb, c+r0*ldc+c0, ldc);
     }
-  }
+  });
   return result;
 }
 
 template <typename T>
 Vector<T> Matrix<T>::operator*(const Vector<T>& v) const
 {
-  //use the code for matrix multiplcation, but with a matrix of v.size() x 1
-  Matrix<T> temp(v.size(), 1);
-  //Set the sole column to the vector passes, and then use the code for matrix multiplcaiton
-  temp.set_col(0, v);
-  //Return the only column vector
-  return ((*this)*temp).col_vector(0);
+  if(m_cols != v.size())
+    throw MatrixDimError(v.size(), m_cols);
+  Vector<T> result(m_rows);
+  const T* x = v.data();
+  T* y = result.data();
+  //Each row is contiguous, so every entry of the result is one streaming dot product
+  Thread_Pool::shared().parallel_for(0, m_rows, Thread_Pool::grain(m_cols), [this, x, y](unsigned int first, unsigned int last)
+  {
+    for(unsigned int i = first; i < last; i++)
+      y[i] = static_cast<T>(Vector_Kernels<T>::dot(m_elements.data()+i*m_stride, x, m_cols));
+  });
+  return result;
 }
 
 template <typename T>
@@ -193,17 +265,9 @@ Matrix<T>& Matrix<T>::operator=(Matrix<T> m)
 template <typename T>
 Matrix<T>& Matrix<T>::operator=(const Abstract_Matrix<T>& m)
 {
-  m_rows = m.num_rows();
-  m_cols = m.num_cols();
-  m_row_vectors = Array<Vector<T>>(m_rows);
-  for(unsigned int i = 0; i < m_rows; i++)
-  {
-    m_row_vectors[i] = Vector<T>(m_cols);
-    for(unsigned int j = 0; j < m_cols; j++)
-    {
-      m_row_vectors[i][j] = m(i, j);
-    }
-  }
+  //Copy first, m may be the calling object
+  Matrix<T> temp(m);
+  swap((*this), temp);
   return (*this);
 }
 
@@ -219,24 +283,42 @@ unsigned int Matrix<T>::num_cols() const
   return m_cols;
 }
 
+template <typename T>
+unsigned int Matrix<T>::stride() const
+{
+  return m_stride;
+}
+
+template <typename T>
+T* Matrix<T>::data()
+{
+  return m_elements.data();
+}
+
+template <typename T>
+const T* Matrix<T>::data() const
+{
+  return m_elements.data();
+}
+
 template <typename T>
 T Matrix<T>::operator()(unsigned int row, unsigned int col) const
 {
-  if(!(row >= 0 && row < m_rows))
+  if(row >= m_rows)
     throw RangeError(row);
-  if(!(col >= 0 && col < m_cols))
+  if(col >= m_cols)
     throw RangeError(col);
-  return m_row_vectors[row][col];
+  return m_elements.data()[row*m_stride+col];
 }
 
 template <typename T>
 T& Matrix<T>::get_elem(unsigned int row, unsigned int col)
 {
-  if(!(row >= 0 && row < m_rows))
+  if(row >= m_rows)
     throw RangeError(row);
-  if(!(col >= 0 && col < m_cols))
+  if(col >= m_cols)
     throw RangeError(col);
-  return m_row_vectors[row][col];
+  return m_elements.data()[row*m_stride+col];
 }
 
 template <typename T>
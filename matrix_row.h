@@ -0,0 +1,104 @@
+#ifndef MATRIX_ROW_H
+#define MATRIX_ROW_H
+/**
+ *  @file matrix_row.h
+ *  @brief Class defintion for matrix row
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <iostream>
+#include <type_traits>
+#include "vector.h"
+#include "InputError.h"
+
+///
+/// \class Matrix_Row
+/// \brief This class is a lightweight view of one row of a Matrix. It does not
+///        own its elements, so it is only valid while the matrix it came from
+///        is alive and not resized. T is const qualified for views of a const
+///        matrix.
+///
+
+template <typename T>
+class Matrix_Row
+{
+private:
+  T* m_data; //!< first element of the row inside the matrix storage
+  unsigned int m_n; //!< number of elements in the row
+public:
+  /*! type of the elements without the const qualifier */
+  typedef typename std::remove_const<T>::type value_type;
+  //! Constructor
+  /// \pre data points to at least n contiguous elements
+  /// \post A view of the n elements starting at data is created
+  /// @param data of type T*
+  /// @param n of type unsigned int
+  Matrix_Row(T* data, unsigned int n):m_data(data), m_n(n){}
+  //! Copy Constructor
+  /// \pre None
+  /// \post A view of the same row as r is created, no elements are copied
+  /// @param r of type const Matrix_Row<T>&
+  Matrix_Row(const Matrix_Row<T>& r):m_data(r.m_data), m_n(r.m_n){}
+  //! Element accessor
+  /// \pre index is an unsigned integer between 0 and size()-1
+  /// \post returns reference to the element at index. Throws error if index is out of range
+  /// @param index of type unsigned int
+  T& operator[](unsigned int index) const;
+  //! Assignment from a vector
+  /// \pre v must be of size size(). The view must not be of a const matrix
+  /// \post The elements of the row are now copies of the elements of v. Throws error if v is not of size size()
+  /// @param v of type const Vector<value_type>&
+  Matrix_Row<T>& operator=(const Vector<value_type>& v);
+  //! Assignment from another row
+  /// \pre r must be of size size(). The view must not be of a const matrix
+  /// \post The elements of the row are now copies of the elements of r, the view itself still refers to the same row. Throws error if r is not of size size()
+  /// @param r of type const Matrix_Row<T>&
+  Matrix_Row<T>& operator=(const Matrix_Row<T>& r);
+  //! Conversion to a vector
+  /// \pre None
+  /// \post Returns a Vector holding a copy of the row
+  operator Vector<value_type>() const;
+  //! Returns size of the row
+  /// \pre None
+  /// \post returns unsigned int of the number of element in the row
+  unsigned int size() const;
+  //! Raw pointer to the elements
+  /// \pre None
+  /// \post Returns the pointer to the first element of the row, no range checking is done through it
+  T* data() const;
+
+  //! insertion operator
+  /// \pre operator<< defined for T
+  /// \post Entry of elements in inserted into ostream reference
+  /// @param os of type ostream&
+  /// @param r of type const Matrix_Row<T>&
+  friend std::ostream& operator<<(std::ostream& os, const Matrix_Row<T>& r)
+  {
+    for(unsigned int i = 0; i < r.m_n; i++)
+      os << r.m_data[i] << " ";
+    return os;
+  }
+  //! extration operator
+  /// \pre operator>> defined for T. The view must not be of a const matrix
+  /// \post size() values are inserted into the row in that order given by istream
+  /// @param in of type istream&
+  /// @param r of type const Matrix_Row<T>&
+  friend std::istream& operator>>(std::istream& in, const Matrix_Row<T>& r)
+  {
+    for(unsigned int i = 0; i < r.m_n; i++)
+    {
+      if(!in)
+      {
+        InputError n;
+        throw n;
+      }
+      in >> r.m_data[i];
+    }
+    return in;
+  }
+};
+
+#include "matrix_row.hpp"
+
+#endif
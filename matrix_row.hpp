@@ -0,0 +1,59 @@
+/**
+ *  @file matrix_row.hpp
+ *  @brief Class implmentation for matrix row
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "vector.h"
+#include "RangeError.h"
+#include "DimensionError.h"
+
+template <typename T>
+T& Matrix_Row<T>::operator[](unsigned int index) const
+{
+  if(index >= m_n)
+    throw RangeError(index);
+  return m_data[index];
+}
+
+template <typename T>
+Matrix_Row<T>& Matrix_Row<T>::operator=(const Vector<value_type>& v)
+{
+  if(v.size() != m_n)
+    throw DimensionError(v.size());
+  for(unsigned int i = 0; i < m_n; i++)
+    m_data[i] = v[i];
+  return (*this);
+}
+
+template <typename T>
+Matrix_Row<T>& Matrix_Row<T>::operator=(const Matrix_Row<T>& r)
+{
+  if(r.m_n != m_n)
+    throw DimensionError(r.m_n);
+  for(unsigned int i = 0; i < m_n; i++)
+    m_data[i] = r.m_data[i];
+  return (*this);
+}
+
+template <typename T>
+Matrix_Row<T>::operator Vector<value_type>() const
+{
+  Vector<value_type> temp(m_n);
+  for(unsigned int i = 0; i < m_n; i++)
+    temp[i] = m_data[i];
+  return temp;
+}
+
+template <typename T>
+unsigned int Matrix_Row<T>::size() const
+{
+  return m_n;
+}
+
+template <typename T>
+T* Matrix_Row<T>::data() const
+{
+  return m_data;
+}
@@ -0,0 +1,115 @@
+#ifndef MULTIGRID_H
+#define MULTIGRID_H
+
+/**
+ *  @file multigrid.h
+ *  @brief Class defintion for multigrid
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "vector.h"
+#include "Aligned_Array.h"
+#include "cholesky.h"
+
+///
+/// \enum Smoother
+/// \brief The relaxation used by Multigrid before and after each coarse grid correction
+///
+
+enum Smoother
+{
+  WEIGHTED_JACOBI, //!< Jacobi damped by 4/5, every point updated from the old values
+  RED_BLACK_GAUSS_SEIDEL //!< Gauss-Seidel over the points with even r+c, then the points with odd r+c
+};
+
+///
+/// \class Multigrid
+/// \brief This class is a geometric multigrid solver for the finite difference
+///        system of FiniteDiff, u - 0.25*(sum of the four neighbours) = f on a
+///        square grid of numDivs divisions per side. Each coarser grid has
+///        half the divisions, rounded up, down to a grid of one interior
+///        point that is solved directly. Corrections are moved up by bilinear
+///        interpolation from the coarse cell around each fine point, and
+///        residuals down by its transpose, which is full weighting when the
+///        divisions are even. With odd divisions the coarse points do not
+///        sit on fine points, but the same interpolation applies.
+///
+
+template <typename T>
+class Multigrid
+{
+private:
+  unsigned int m_numDivs; //!< divisions per side of the finest grid
+  unsigned int m_levels; //!< number of grids, the finest is level 0
+  Smoother m_smoother; //!< relaxation used on every grid
+  unsigned int m_preSweeps; //!< relaxation sweeps before the coarse grid correction
+  unsigned int m_postSweeps; //!< relaxation sweeps after the coarse grid correction
+  Cholesky_Decomposition<T> m_coarse; //!< factor of the system on the coarsest grid
+  //! Divisions of a grid
+  /// \pre level < m_levels
+  /// \post Returns the divisions per side of the grid at level
+  unsigned int divisions(unsigned int level) const;
+  //! Relaxation
+  /// \pre u and f hold the points of a grid with divs divisions per side
+  /// \post sweeps sweeps of m_smoother have been applied to u
+  void smooth(unsigned int divs, const Vector<T>& f, Vector<T>& u, unsigned int sweeps) const;
+  //! Interpolation along one side
+  /// \pre divs > 2
+  /// \post For each fine point p of a side with divs divisions, 0 < p < divs, cell[2p] and cell[2p+1] are the interior coarse points on either side of it on the grid with (divs+1)/2 divisions, counted from 0, and weight[2p] and weight[2p+1] their shares of it. A coarse point on the boundary has weight 0
+  /// @param divs of type unsigned int
+  /// @param cell of type Aligned_Array<unsigned int>&
+  /// @param weight of type Aligned_Array<T>&
+  void coarse_cells(unsigned int divs, Aligned_Array<unsigned int>& cell, Aligned_Array<T>& weight) const;
+  //! Restriction
+  /// \pre divs > 2. r holds the points of a grid with divs divisions per side
+  /// \post Returns the transpose of the bilinear interpolation applied to r, on the grid with (divs+1)/2 divisions. This is full weighting times 4 when divs is even, the 4 being the ratio of the scaled operators of the two grids
+  Vector<T> restrict_to_coarse(unsigned int divs, const Vector<T>& r) const;
+  //! Prolongation
+  /// \pre divs > 2. e holds the points of the grid with (divs+1)/2 divisions, u of the grid with divs divisions
+  /// \post The bilinear interpolation of e is added to u
+  void prolong_to_fine(unsigned int divs, const Vector<T>& e, Vector<T>& u) const;
+  //! V-cycle from a level down
+  /// \pre u and f hold the points of the grid at level
+  /// \post One V-cycle on the system at level has been applied to u
+  void cycle(unsigned int level, const Vector<T>& f, Vector<T>& u) const;
+public:
+  //! Constructor
+  /// \pre numDivs > 0
+  /// \post Multigrid object created for a grid with numDivs divisions per side, coarsened down to one interior point, and the coarsest grid is factored
+  /// @param numDivs of type unsigned int
+  /// @param smoother of type Smoother
+  /// @param preSweeps of type unsigned int
+  /// @param postSweeps of type unsigned int
+  Multigrid(unsigned int numDivs, Smoother smoother = RED_BLACK_GAUSS_SEIDEL, unsigned int preSweeps = 2, unsigned int postSweeps = 2);
+  //! V-cycle
+  /// \pre f and u hold the (numDivs-1)^2 points of the finest grid
+  /// \post Returns u after one V-cycle. Throws error if the sizes do not match
+  /// @param f of type const Vector<T>&
+  /// @param u of type Vector<T>
+  Vector<T> v_cycle(const Vector<T>& f, Vector<T> u) const;
+  //! Full multigrid
+  /// \pre f holds the (numDivs-1)^2 points of the finest grid
+  /// \post Returns an approximation to the solution accurate to about the discretization error, built from the coarsest grid up with one V-cycle per grid. Throws error if the size does not match
+  /// @param f of type const Vector<T>&
+  Vector<T> fmg(const Vector<T>& f) const;
+  //! Function Operator
+  /// \pre f holds the (numDivs-1)^2 points of the finest grid. tolerance > 0
+  /// \post Returns u of Au = f, starting from full multigrid and then running V-cycles until the residual norm is at most tolerance times the norm of f. Throws error if the size does not match or if the tolerance is not met within maxCycles V-cycles
+  /// @param f of type const Vector<T>&
+  /// @param tolerance of type double
+  /// @param maxCycles of type unsigned int
+  Vector<T> operator()(const Vector<T>& f, double tolerance = 1.0E-10, unsigned int maxCycles = 50) const;
+  //! Returns the number of grids
+  /// \pre None
+  /// \post Returns the number of grids, counting the finest
+  unsigned int levels() const;
+  //! Returns the size of the direct solve
+  /// \pre None
+  /// \post Returns the number of unknowns of the coarsest grid, at most 1
+  unsigned int coarse_size() const;
+};
+
+#include "multigrid.hpp"
+
+#endif
@@ -0,0 +1,268 @@
+/**
+ *  @file multigrid.hpp
+ *  @brief Class implmentation for multigrid
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "vector.h"
+#include "Array.h"
+#include "symmetric_banded_matrix.h"
+#include "poisson_stencil_matrix.h"
+#include "cholesky.h"
+#include "DimensionError.h"
+#include "ConvergenceError.h"
+#include "parallel_kernels.h"
+
+template <typename T>
+Multigrid<T>::Multigrid(unsigned int numDivs, Smoother smoother, unsigned int preSweeps, unsigned int postSweeps)
+  :m_numDivs(numDivs),m_levels(1),m_smoother(smoother),m_preSweeps(preSweeps),m_postSweeps(postSweeps)
+{
+  //Coarsen down to one interior point, so the direct solve stays tiny
+  //whatever the divisions
+  while(divisions(m_levels-1) > 2)
+    m_levels++;
+
+  //Assemble the coarsest system the same way FiniteDiff does
+  int divs = divisions(m_levels-1);
+  int side = (divs > 0 ? divs-1 : 0);
+  int size = side*side;
+  Symmetric_Banded_Matrix<T> coarse(size, side);
+  for(int i = 0; i < size; i++)
+  {
+    coarse.get_elem(i, i) = 1;
+    if(i < size-1 && ((i+1) % side != 0))
+      coarse.get_elem(i+1, i) = static_cast<T>(-0.25);
+    if(i < size-side)
+      coarse.get_elem(i+side, i) = static_cast<T>(-0.25);
+  }
+  m_coarse.factor(coarse);
+}
+
+template <typename T>
+unsigned int Multigrid<T>::divisions(unsigned int level) const
+{
+  unsigned int divs = m_numDivs;
+  for(unsigned int l = 0; l < level; l++)
+    divs = (divs+1)/2;
+  return divs;
+}
+
+template <typename T>
+void Multigrid<T>::smooth(unsigned int divs, const Vector<T>& f, Vector<T>& u, unsigned int sweeps) const
+{
+  unsigned int side = divs-1;
+  const T quarter = static_cast<T>(0.25);
+  if(m_smoother == WEIGHTED_JACOBI)
+  {
+    Poisson_Stencil_Matrix<T> a(divs);
+    for(unsigned int k = 0; k < sweeps; k++)
+    {
+      //The diagonal is 1, so the update is the damped residual
+      Vector<T> r(f - a*u);
+      Parallel_Kernels<T>::axpy(static_cast<T>(0.8), r.data(), u.data(), u.size());
+    }
+    return;
+  }
+
+  T* x = u.data();
+  const T* b = f.data();
+  for(unsigned int k = 0; k < sweeps; k++)
+  {
+    for(unsigned int color = 0; color < 2; color++)
+    {
+      for(unsigned int r = 0; r < side; r++)
+      {
+        //Points of this color in grid row r start at column (r+color)%2
+        for(unsigned int c = (r+color) % 2; c < side; c += 2)
+        {
+          unsigned int i = r*side+c;
+          T sum = 0;
+          if(c > 0)
+            sum += x[i-1];
+          if(c+1 < side)
+            sum += x[i+1];
+          if(r > 0)
+            sum += x[i-side];
+          if(r+1 < side)
+            sum += x[i+side];
+          x[i] = b[i] + quarter*sum;
+        }
+      }
+    }
+  }
+}
+
+template <typename T>
+void Multigrid<T>::coarse_cells(unsigned int divs, Aligned_Array<unsigned int>& cell, Aligned_Array<T>& weight) const
+{
+  //Fine point p is at p/divs of the side, which is p*coarse/divs in coarse
+  //points. Even divisions put every other fine point on a coarse one
+  unsigned int coarse = (divs+1)/2;
+  cell = Aligned_Array<unsigned int>(2*divs);
+  weight = Aligned_Array<T>(2*divs);
+  for(unsigned int p = 1; p < divs; p++)
+  {
+    unsigned int left = p*coarse/divs;
+    T share = static_cast<T>(p*coarse % divs)/static_cast<T>(divs);
+    //Coarse points 0 and coarse are on the boundary, where the correction
+    //is zero, so they keep weight 0 and any valid index
+    if(left > 0)
+    {
+      cell[2*p] = left-1;
+      weight[2*p] = 1-share;
+    }
+    if(left+1 < coarse)
+    {
+      cell[2*p+1] = left;
+      weight[2*p+1] = share;
+    }
+  }
+}
+
+template <typename T>
+Vector<T> Multigrid<T>::restrict_to_coarse(unsigned int divs, const Vector<T>& r) const
+{
+  unsigned int side = divs-1;
+  unsigned int coarse_side = (divs+1)/2-1;
+  Aligned_Array<unsigned int> cell;
+  Aligned_Array<T> weight;
+  coarse_cells(divs, cell, weight);
+  const unsigned int* c = cell.data();
+  const T* w = weight.data();
+  const T* fine = r.data();
+  Vector<T> result(coarse_side*coarse_side);
+  T* coarse = result.data();
+  //Each fine residual goes back to the coarse points it was interpolated
+  //from, with the same weights. The factor 4 between the scaled operators
+  //of the grids cancels the 1/4 of full weighting
+  for(unsigned int fr = 1; fr <= side; fr++)
+  {
+    T* row0 = coarse + c[2*fr]*coarse_side;
+    T* row1 = coarse + c[2*fr+1]*coarse_side;
+    for(unsigned int fc = 1; fc <= side; fc++)
+    {
+      T value = fine[(fr-1)*side + fc-1];
+      T left = w[2*fc]*value;
+      T right = w[2*fc+1]*value;
+      row0[c[2*fc]] += w[2*fr]*left;
+      row0[c[2*fc+1]] += w[2*fr]*right;
+      row1[c[2*fc]] += w[2*fr+1]*left;
+      row1[c[2*fc+1]] += w[2*fr+1]*right;
+    }
+  }
+  return result;
+}
+
+template <typename T>
+void Multigrid<T>::prolong_to_fine(unsigned int divs, const Vector<T>& e, Vector<T>& u) const
+{
+  unsigned int side = divs-1;
+  unsigned int coarse_side = (divs+1)/2-1;
+  Aligned_Array<unsigned int> cell;
+  Aligned_Array<T> weight;
+  coarse_cells(divs, cell, weight);
+  const unsigned int* c = cell.data();
+  const T* w = weight.data();
+  const T* coarse = e.data();
+  T* fine = u.data();
+  //Every fine point takes the bilinear interpolation of the corners of the
+  //coarse cell around it
+  for(unsigned int fr = 1; fr <= side; fr++)
+  {
+    const T* row0 = coarse + c[2*fr]*coarse_side;
+    const T* row1 = coarse + c[2*fr+1]*coarse_side;
+    for(unsigned int fc = 1; fc <= side; fc++)
+    {
+      T below = w[2*fc]*row0[c[2*fc]] + w[2*fc+1]*row0[c[2*fc+1]];
+      T above = w[2*fc]*row1[c[2*fc]] + w[2*fc+1]*row1[c[2*fc+1]];
+      fine[(fr-1)*side + fc-1] += w[2*fr]*below + w[2*fr+1]*above;
+    }
+  }
+}
+
+template <typename T>
+void Multigrid<T>::cycle(unsigned int level, const Vector<T>& f, Vector<T>& u) const
+{
+  if(level == m_levels-1)
+  {
+    u = m_coarse.solve(f);
+    return;
+  }
+  unsigned int divs = divisions(level);
+  smooth(divs, f, u, m_preSweeps);
+  Poisson_Stencil_Matrix<T> a(divs);
+  Vector<T> coarse_f(restrict_to_coarse(divs, f - a*u));
+  Vector<T> coarse_u(coarse_f.size());
+  cycle(level+1, coarse_f, coarse_u);
+  prolong_to_fine(divs, coarse_u, u);
+  smooth(divs, f, u, m_postSweeps);
+}
+
+template <typename T>
+Vector<T> Multigrid<T>::v_cycle(const Vector<T>& f, Vector<T> u) const
+{
+  unsigned int side = (m_numDivs > 0 ? m_numDivs-1 : 0);
+  if(f.size() != side*side)
+    throw DimensionError(f.size());
+  if(u.size() != side*side)
+    throw DimensionError(u.size());
+  cycle(0, f, u);
+  return u;
+}
+
+template <typename T>
+Vector<T> Multigrid<T>::fmg(const Vector<T>& f) const
+{
+  unsigned int side = (m_numDivs > 0 ? m_numDivs-1 : 0);
+  if(f.size() != side*side)
+    throw DimensionError(f.size());
+  //Right hand sides on every grid, finest first
+  Array<Vector<T>> rhs(m_levels);
+  rhs[0] = f;
+  for(unsigned int level = 1; level < m_levels; level++)
+    rhs[level] = restrict_to_coarse(divisions(level-1), rhs[level-1]);
+
+  //Solve on the coarsest grid, then interpolate each solution up as the
+  //first guess of the next finer grid and improve it with one V-cycle
+  Vector<T> u(m_coarse.solve(rhs[m_levels-1]));
+  for(unsigned int level = m_levels-1; level-- > 0;)
+  {
+    unsigned int fine_side = divisions(level)-1;
+    Vector<T> fine_u(fine_side*fine_side);
+    prolong_to_fine(divisions(level), u, fine_u);
+    cycle(level, rhs[level], fine_u);
+    u = fine_u;
+  }
+  return u;
+}
+
+template <typename T>
+Vector<T> Multigrid<T>::operator()(const Vector<T>& f, double tolerance, unsigned int maxCycles) const
+{
+  Vector<T> u(fmg(f));
+  Poisson_Stencil_Matrix<T> a(m_numDivs);
+  double stop = tolerance*tolerance*Parallel_Kernels<T>::dot(f.data(), f.data(), f.size());
+  for(unsigned int k = 0; ; k++)
+  {
+    Vector<T> r(f - a*u);
+    if(Parallel_Kernels<T>::dot(r.data(), r.data(), r.size()) <= stop)
+      return u;
+    if(k == maxCycles)
+      throw ConvergenceError();
+    cycle(0, f, u);
+  }
+}
+
+template <typename T>
+unsigned int Multigrid<T>::levels() const
+{
+  return m_levels;
+}
+
+template <typename T>
+unsigned int Multigrid<T>::coarse_size() const
+{
+  unsigned int divs = divisions(m_levels-1);
+  return (divs > 0 ? (divs-1)*(divs-1) : 0);
+}
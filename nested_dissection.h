@@ -0,0 +1,71 @@
+#ifndef NESTED_DISSECTION_H
+#define NESTED_DISSECTION_H
+
+/**
+ *  @file nested_dissection.h
+ *  @brief Class defintion for nested dissection
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "Aligned_Array.h"
+#include "abstract_matrix.h"
+#include "symmetric_banded_matrix.h"
+#include "sparse_matrix.h"
+#include "adjacency_graph.h"
+#include "permutation.h"
+
+///
+/// \class Nested_Dissection
+/// \brief This class is the nested dissection fill reducing ordering
+///        implemented as a class. A separator splits the unknowns into two
+///        parts with no coupling between them. The two parts are ordered
+///        first, each by the same method, and the separator is ordered last,
+///        so factoring one part never fills in the other. Parts of at most
+///        the leaf size are left in their natural order. Grids are split
+///        along their middle grid line, and general graphs along a level of
+///        a breadth first search from a pseudo-peripheral node.
+///
+
+template <typename T>
+class Nested_Dissection
+{
+private:
+  unsigned int m_leafSize; //!< parts with at most this many unknowns are not split
+public:
+  //! Constructor
+  /// \pre leafSize > 0
+  /// \post Functor Nested_Dissection object created
+  /// @param leafSize of type unsigned int
+  Nested_Dissection(unsigned int leafSize = 64):m_leafSize(leafSize > 0 ? leafSize : 1){}
+  //! Function Operator on a graph
+  /// \pre None
+  /// \post Returns the nested dissection order of the nodes of g
+  /// @param g of type const Adjacency_Graph&
+  Permutation operator()(const Adjacency_Graph& g) const;
+  //! Function Operator
+  /// \pre m is square. Comparison to 0 must be defined for T
+  /// \post Returns the nested dissection order of the pattern of m + m^T. Throws error if m is not square
+  /// @param m of type const Abstract_Matrix<T>&
+  Permutation operator()(const Abstract_Matrix<T>& m) const;
+  //! Function Operator for banded matrices
+  /// \pre Comparison to 0 must be defined for T
+  /// \post Returns the nested dissection order of the pattern of m, reading only the band
+  /// @param m of type const Symmetric_Banded_Matrix<T>&
+  Permutation operator()(const Symmetric_Banded_Matrix<T>& m) const;
+  //! Function Operator for sparse matrices
+  /// \pre m is square. Comparison to 0 must be defined for T
+  /// \post Returns the nested dissection order of the pattern of m + m^T, reading only the stored elements. Throws error if m is not square
+  /// @param m of type const Sparse_Matrix<T>&
+  Permutation operator()(const Sparse_Matrix<T>& m) const;
+  //! Geometric ordering of a grid
+  /// \pre Unknown r*cols+c is the grid point in row r and column c, coupled only to its neighbours in the grid, as in FiniteDiff
+  /// \post Returns the nested dissection order using grid lines as separators
+  /// @param rows of type unsigned int
+  /// @param cols of type unsigned int
+  Permutation grid(unsigned int rows, unsigned int cols) const;
+};
+
+#include "nested_dissection.hpp"
+
+#endif
@@ -0,0 +1,238 @@
+/**
+ *  @file nested_dissection.hpp
+ *  @brief Class implmentation for nested dissection
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+template <typename T>
+Permutation Nested_Dissection<T>::operator()(const Adjacency_Graph& g) const
+{
+  unsigned int n = g.size();
+  const unsigned int* start = g.start();
+  const unsigned int* adjacent = g.adjacent();
+
+  //order is split in place, every region is a contiguous range of it and
+  //the separator of a region is moved to the end of its range
+  Aligned_Array<unsigned int> order(n);
+  Aligned_Array<unsigned int> region(n);
+  Aligned_Array<unsigned int> mark(n);
+  Aligned_Array<unsigned int> level(n);
+  Aligned_Array<unsigned int> queue(n);
+  Aligned_Array<unsigned int> scratch(n);
+  Aligned_Array<unsigned char> side(n);
+  for(unsigned int i = 0; i < n; i++)
+    order[i] = i;
+
+  //Stack of ranges still to split. The ranges are disjoint and not empty,
+  //so there are never more than n of them
+  Aligned_Array<unsigned int> low(n);
+  Aligned_Array<unsigned int> high(n);
+  unsigned int top = 0;
+  unsigned int stamp = 1;
+  unsigned int next_id = 1;
+  if(n > 0)
+  {
+    low[top] = 0;
+    high[top++] = n;
+  }
+
+  while(top > 0)
+  {
+    top--;
+    unsigned int lo = low[top];
+    unsigned int hi = high[top];
+    unsigned int size = hi-lo;
+    if(size <= m_leafSize)
+      continue;
+
+    unsigned int count, depth;
+    g.peripheral_node(order[lo], region.data(), mark.data(), stamp,
+                      level.data(), queue.data(), count, depth);
+    unsigned int reached = stamp-1;
+
+    unsigned int separator_level = 0;
+    if(count == size)
+    {
+      //Too shallow to split, a clique or close to one
+      if(depth < 3)
+        continue;
+      //The level holding the middle node splits the region about in half
+      separator_level = level[queue[size/2]];
+      if(separator_level < 1)
+        separator_level = 1;
+      if(separator_level > depth-2)
+        separator_level = depth-2;
+    }
+
+    //Put each node in a part, 0 before the separator, 1 after it and 2 in
+    //it. A region that is not connected is split into the component that
+    //was reached and the rest, with no separator
+    unsigned int first_size = 0;
+    unsigned int second_size = 0;
+    for(unsigned int i = lo; i < hi; i++)
+    {
+      unsigned int node = order[i];
+      if(mark[node] != reached)
+        side[node] = 1;
+      else if(count < size)
+        side[node] = 0;
+      else if(level[node] < separator_level)
+        side[node] = 0;
+      else if(level[node] > separator_level)
+        side[node] = 1;
+      else
+      {
+        //A separator node with nothing on the far side can join the near side
+        side[node] = 0;
+        for(unsigned int k = start[node]; k < start[node+1]; k++)
+        {
+          unsigned int next = adjacent[k];
+          if(mark[next] == reached && level[next] == separator_level+1)
+          {
+            side[node] = 2;
+            break;
+          }
+        }
+      }
+      if(side[node] == 0)
+        first_size++;
+      else if(side[node] == 1)
+        second_size++;
+    }
+
+    //Move the parts into place, separator last
+    unsigned int position[3] = {lo, lo+first_size, lo+first_size+second_size};
+    for(unsigned int i = lo; i < hi; i++)
+      scratch[position[side[order[i]]]++] = order[i];
+    for(unsigned int i = lo; i < hi; i++)
+      order[i] = scratch[i];
+
+    //Separator nodes leave every region, region 0 is only the whole graph
+    unsigned int first_id = next_id++;
+    unsigned int second_id = next_id++;
+    for(unsigned int i = lo; i < lo+first_size; i++)
+      region[order[i]] = first_id;
+    for(unsigned int i = lo+first_size; i < lo+first_size+second_size; i++)
+      region[order[i]] = second_id;
+    for(unsigned int i = lo+first_size+second_size; i < hi; i++)
+      region[order[i]] = 0;
+
+    if(second_size > 0)
+    {
+      low[top] = lo+first_size;
+      high[top++] = lo+first_size+second_size;
+    }
+    if(first_size > 0)
+    {
+      low[top] = lo;
+      high[top++] = lo+first_size;
+    }
+  }
+  return Permutation(order);
+}
+
+template <typename T>
+Permutation Nested_Dissection<T>::operator()(const Abstract_Matrix<T>& m) const
+{
+  return (*this)(Adjacency_Graph(m));
+}
+
+template <typename T>
+Permutation Nested_Dissection<T>::operator()(const Symmetric_Banded_Matrix<T>& m) const
+{
+  return (*this)(Adjacency_Graph(m));
+}
+
+template <typename T>
+Permutation Nested_Dissection<T>::operator()(const Sparse_Matrix<T>& m) const
+{
+  return (*this)(Adjacency_Graph(m));
+}
+
+template <typename T>
+Permutation Nested_Dissection<T>::grid(unsigned int rows, unsigned int cols) const
+{
+  unsigned int n = rows*cols;
+  Aligned_Array<unsigned int> order(n);
+
+  //Stack of rectangles still to order, rows row0 to row1-1 and columns col0
+  //to col1-1, to be placed in order from position on
+  Aligned_Array<unsigned int> row0(n);
+  Aligned_Array<unsigned int> row1(n);
+  Aligned_Array<unsigned int> col0(n);
+  Aligned_Array<unsigned int> col1(n);
+  Aligned_Array<unsigned int> position(n);
+  unsigned int top = 0;
+  if(n > 0)
+  {
+    row0[top] = 0;
+    row1[top] = rows;
+    col0[top] = 0;
+    col1[top] = cols;
+    position[top++] = 0;
+  }
+
+  while(top > 0)
+  {
+    top--;
+    unsigned int r0 = row0[top];
+    unsigned int r1 = row1[top];
+    unsigned int c0 = col0[top];
+    unsigned int c1 = col1[top];
+    unsigned int pos = position[top];
+    unsigned int height = r1-r0;
+    unsigned int width = c1-c0;
+
+    if(height*width <= m_leafSize)
+    {
+      for(unsigned int r = r0; r < r1; r++)
+        for(unsigned int c = c0; c < c1; c++)
+          order[pos++] = r*cols+c;
+      continue;
+    }
+
+    //Cut across the longer side so the separator is as short as possible
+    unsigned int first_size, second_size;
+    unsigned int second_r0 = r0, second_c0 = c0;
+    unsigned int first_r1 = r1, first_c1 = c1;
+    if(height >= width)
+    {
+      unsigned int middle = r0+height/2;
+      first_r1 = middle;
+      second_r0 = middle+1;
+      first_size = (middle-r0)*width;
+      second_size = (r1-middle-1)*width;
+      for(unsigned int c = c0; c < c1; c++)
+        order[pos+first_size+second_size+c-c0] = middle*cols+c;
+    }
+    else
+    {
+      unsigned int middle = c0+width/2;
+      first_c1 = middle;
+      second_c0 = middle+1;
+      first_size = height*(middle-c0);
+      second_size = height*(c1-middle-1);
+      for(unsigned int r = r0; r < r1; r++)
+        order[pos+first_size+second_size+r-r0] = r*cols+middle;
+    }
+
+    if(second_size > 0)
+    {
+      row0[top] = second_r0;
+      row1[top] = r1;
+      col0[top] = second_c0;
+      col1[top] = c1;
+      position[top++] = pos+first_size;
+    }
+    if(first_size > 0)
+    {
+      row0[top] = r0;
+      row1[top] = first_r1;
+      col0[top] = c0;
+      col1[top] = first_c1;
+      position[top++] = pos;
+    }
+  }
+  return Permutation(order);
+}
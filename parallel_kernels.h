@@ -0,0 +1,55 @@
+#ifndef PARALLEL_KERNELS_H
+#define PARALLEL_KERNELS_H
+
+/**
+ *  @file parallel_kernels.h
+ *  @brief Class defintion for parallel kernels
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "vector_kernels.h"
+#include "thread_pool.h"
+
+///
+/// \class Parallel_Kernels
+/// \brief This class holds the whole vector versions of the kernels of
+///        Vector_Kernels. Vectors of at least PARALLEL_SIZE elements are
+///        split into pieces of GRAIN elements run on the shared Thread_Pool,
+///        shorter ones run the kernel of Vector_Kernels directly. The pieces
+///        of a dot product are combined by parallel_reduce, so it follows the
+///        deterministic mode of the pool
+///
+
+template <typename T>
+class Parallel_Kernels
+{
+private:
+  static const unsigned int PARALLEL_SIZE = 1 << 15; //!< shortest vector split over the pool, shorter ones cost more to hand out than to compute
+  static const unsigned int GRAIN = 1 << 13; //!< elements in a piece of a split vector
+public:
+  //! Dot product
+  /// \pre x and y point to n elements. The product of two T must be representable as a double
+  /// \post Returns the sum of x[i]*y[i], accumulated in double
+  static double dot(const T* x, const T* y, unsigned int n);
+  //! Scaling
+  /// \pre x and z point to n elements, they may be the same
+  /// \post z[i] = alpha*x[i]
+  static void scale(const T* x, const T& alpha, T* z, unsigned int n);
+  //! Addition
+  /// \pre x, y and z point to n elements, z may be x or y
+  /// \post z[i] = x[i]+y[i]
+  static void add(const T* x, const T* y, T* z, unsigned int n);
+  //! Substraction
+  /// \pre x, y and z point to n elements, z may be x or y
+  /// \post z[i] = x[i]-y[i]
+  static void subtract(const T* x, const T* y, T* z, unsigned int n);
+  //! Scaled addition in place
+  /// \pre x and y point to n elements
+  /// \post y[i] = y[i]+alpha*x[i]
+  static void axpy(const T& alpha, const T* x, T* y, unsigned int n);
+};
+
+#include "parallel_kernels.hpp"
+
+#endif
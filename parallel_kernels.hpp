@@ -0,0 +1,54 @@
+/**
+ *  @file parallel_kernels.hpp
+ *  @brief Class implmentation for parallel kernels
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <functional>
+
+template <typename T>
+double Parallel_Kernels<T>::dot(const T* x, const T* y, unsigned int n)
+{
+  if(n < PARALLEL_SIZE)
+    return Vector_Kernels<T>::dot(x, y, n);
+  return Thread_Pool::shared().parallel_reduce(0, n, GRAIN, 0.0,
+    [x, y](unsigned int first, unsigned int last){ return Vector_Kernels<T>::dot(x+first, y+first, last-first); },
+    std::plus<double>());
+}
+
+template <typename T>
+void Parallel_Kernels<T>::scale(const T* x, const T& alpha, T* z, unsigned int n)
+{
+  if(n < PARALLEL_SIZE)
+    return Vector_Kernels<T>::scale(x, alpha, z, n);
+  Thread_Pool::shared().parallel_for(0, n, GRAIN,
+    [x, &alpha, z](unsigned int first, unsigned int last){ Vector_Kernels<T>::scale(x+first, alpha, z+first, last-first); });
+}
+
+template <typename T>
+void Parallel_Kernels<T>::add(const T* x, const T* y, T* z, unsigned int n)
+{
+  if(n < PARALLEL_SIZE)
+    return Vector_Kernels<T>::add(x, y, z, n);
+  Thread_Pool::shared().parallel_for(0, n, GRAIN,
+    [x, y, z](unsigned int first, unsigned int last){ Vector_Kernels<T>::add(x+first, y+first, z+first, last-first); });
+}
+
+template <typename T>
+void Parallel_Kernels<T>::subtract(const T* x, const T* y, T* z, unsigned int n)
+{
+  if(n < PARALLEL_SIZE)
+    return Vector_Kernels<T>::subtract(x, y, z, n);
+  Thread_Pool::shared().parallel_for(0, n, GRAIN,
+    [x, y, z](unsigned int first, unsigned int last){ Vector_Kernels<T>::subtract(x+first, y+first, z+first, last-first); });
+}
+
+template <typename T>
+void Parallel_Kernels<T>::axpy(const T& alpha, const T* x, T* y, unsigned int n)
+{
+  if(n < PARALLEL_SIZE)
+    return Vector_Kernels<T>::axpy(alpha, x, y, n);
+  Thread_Pool::shared().parallel_for(0, n, GRAIN,
+    [&alpha, x, y](unsigned int first, unsigned int last){ Vector_Kernels<T>::axpy(alpha, x+first, y+first, last-first); });
+}
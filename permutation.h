@@ -0,0 +1,102 @@
+#ifndef PERMUTATION_H
+#define PERMUTATION_H
+
+/**
+ *  @file permutation.h
+ *  @brief Class defintion for permutation
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "Aligned_Array.h"
+#include "vector.h"
+#include "matrix.h"
+#include "symmetric_matrix.h"
+#include "symmetric_banded_matrix.h"
+#include "sparse_matrix.h"
+
+///
+/// \class Permutation
+/// \brief This class is a reordering of the unknowns of a system. Position i
+///        of the new order holds unknown (*this)[i] of the old order. A
+///        system Ax = b is reordered to (PAP^T)(Px) = Pb, so a matrix is
+///        permuted on both sides and the right hand side with apply(), and
+///        the solution is put back in the old order with unapply()
+///
+
+class Permutation
+{
+private:
+  unsigned int m_n; //!< number of unknowns
+  Aligned_Array<unsigned int> m_order; //!< old index of each new position
+  Aligned_Array<unsigned int> m_inverse; //!< new position of each old index
+public:
+  //! Default Constructor
+  /// \pre None
+  /// \post Permutation of no unknowns is created
+  Permutation():m_n(0){}
+  //! Constructor
+  /// \pre None
+  /// \post Identity permutation of n unknowns is created
+  /// @param n of type unsigned int
+  Permutation(unsigned int n);
+  //! Constructor from an order
+  /// \pre order holds each of 0..order.size()-1 exactly once
+  /// \post Permutation with new position i holding old index order[i]. Throws error if order is not a permutation
+  /// @param order of type const Aligned_Array<unsigned int>&
+  Permutation(const Aligned_Array<unsigned int>& order);
+  //! Indexing operator
+  /// \pre i < size()
+  /// \post Returns the old index placed at new position i. Throws error if i is out of range
+  /// @param i of type unsigned int
+  unsigned int operator[](unsigned int i) const;
+  //! Inverse lookup
+  /// \pre old < size()
+  /// \post Returns the new position of old index old. Throws error if old is out of range
+  /// @param old of type unsigned int
+  unsigned int inverse(unsigned int old) const;
+  //! Returns the number of unknowns
+  /// \pre None
+  /// \post Returns the number of unknowns
+  unsigned int size() const;
+  //! Permutes a vector
+  /// \pre v.size() == size()
+  /// \post Returns Pv, element i is v[(*this)[i]]. Throws error if the sizes do not match
+  /// @param v of type const Vector<T>&
+  template <typename T>
+  Vector<T> apply(const Vector<T>& v) const;
+  //! Puts a vector back in the old order
+  /// \pre v.size() == size()
+  /// \post Returns (P^T)v, element (*this)[i] is v[i]. Throws error if the sizes do not match
+  /// @param v of type const Vector<T>&
+  template <typename T>
+  Vector<T> unapply(const Vector<T>& v) const;
+  //! Permutes a dense matrix on both sides
+  /// \pre m is size() x size()
+  /// \post Returns PmP^T, element (i, j) is m((*this)[i], (*this)[j]). Throws error if the sizes do not match
+  /// @param m of type const Matrix<T>&
+  template <typename T>
+  Matrix<T> apply(const Matrix<T>& m) const;
+  //! Permutes a symmetric matrix on both sides
+  /// \pre m is size() x size()
+  /// \post Returns PmP^T, which stays symmetric. Throws error if the sizes do not match
+  /// @param m of type const Symmetric_Matrix<T>&
+  template <typename T>
+  Symmetric_Matrix<T> apply(const Symmetric_Matrix<T>& m) const;
+  //! Permutes a symmetric banded matrix on both sides
+  /// \pre m is size() x size()
+  /// \post Returns PmP^T with the bandwidth its non-zero elements need after reordering. Only the band of m is read. Throws error if the sizes do not match
+  /// @param m of type const Symmetric_Banded_Matrix<T>&
+  template <typename T>
+  Symmetric_Banded_Matrix<T> apply(const Symmetric_Banded_Matrix<T>& m) const;
+  //! Permutes a sparse matrix on both sides
+  /// \pre m is size() x size()
+  /// \post Returns PmP^T, storing the same elements as m. Throws error if the sizes do not match
+  /// @param m of type const Sparse_Matrix<T>&
+  template <typename T>
+  Sparse_Matrix<T> apply(const Sparse_Matrix<T>& m) const;
+};
+
+#include "permutation.hpp"
+
+#endif
@@ -0,0 +1,168 @@
+/**
+ *  @file permutation.hpp
+ *  @brief Class implmentation for permutation
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "RangeError.h"
+#include "DimensionError.h"
+#include "MatrixDimError.h"
+#include "InputError.h"
+
+inline Permutation::Permutation(unsigned int n)
+  :m_n(n),m_order(n),m_inverse(n)
+{
+  for(unsigned int i = 0; i < n; i++)
+    m_order[i] = m_inverse[i] = i;
+}
+
+inline Permutation::Permutation(const Aligned_Array<unsigned int>& order)
+  :m_n(order.size()),m_order(order),m_inverse(order.size())
+{
+  //Fill the inverse with an impossible index first to catch repeats
+  for(unsigned int i = 0; i < m_n; i++)
+    m_inverse[i] = m_n;
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    if(m_order[i] >= m_n || m_inverse[m_order[i]] != m_n)
+      throw InputError();
+    m_inverse[m_order[i]] = i;
+  }
+}
+
+inline unsigned int Permutation::operator[](unsigned int i) const
+{
+  if(i >= m_n)
+    throw RangeError(i);
+  return m_order[i];
+}
+
+inline unsigned int Permutation::inverse(unsigned int old) const
+{
+  if(old >= m_n)
+    throw RangeError(old);
+  return m_inverse[old];
+}
+
+inline unsigned int Permutation::size() const
+{
+  return m_n;
+}
+
+template <typename T>
+Vector<T> Permutation::apply(const Vector<T>& v) const
+{
+  if(v.size() != m_n)
+    throw DimensionError(v.size());
+  Vector<T> result(m_n);
+  const unsigned int* order = m_order.data();
+  for(unsigned int i = 0; i < m_n; i++)
+    result[i] = v[order[i]];
+  return result;
+}
+
+template <typename T>
+Vector<T> Permutation::unapply(const Vector<T>& v) const
+{
+  if(v.size() != m_n)
+    throw DimensionError(v.size());
+  Vector<T> result(m_n);
+  const unsigned int* order = m_order.data();
+  for(unsigned int i = 0; i < m_n; i++)
+    result[order[i]] = v[i];
+  return result;
+}
+
+template <typename T>
+Matrix<T> Permutation::apply(const Matrix<T>& m) const
+{
+  if(m.num_rows() != m_n || m.num_cols() != m_n)
+    throw MatrixDimError(m.num_rows(), m.num_cols());
+  Matrix<T> result(m_n, m_n);
+  const unsigned int* order = m_order.data();
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    const T* source = m[order[i]].data();
+    T* target = result[i].data();
+    for(unsigned int j = 0; j < m_n; j++)
+      target[j] = source[order[j]];
+  }
+  return result;
+}
+
+template <typename T>
+Symmetric_Matrix<T> Permutation::apply(const Symmetric_Matrix<T>& m) const
+{
+  if(m.num_rows() != m_n)
+    throw MatrixDimError(m.num_rows(), m.num_cols());
+  Symmetric_Matrix<T> result(m_n);
+  const unsigned int* order = m_order.data();
+  for(unsigned int i = 0; i < m_n; i++)
+    for(unsigned int j = 0; j <= i; j++)
+      result.get_elem(i, j) = m(order[i], order[j]);
+  return result;
+}
+
+template <typename T>
+Symmetric_Banded_Matrix<T> Permutation::apply(const Symmetric_Banded_Matrix<T>& m) const
+{
+  if(m.num_rows() != m_n)
+    throw MatrixDimError(m.num_rows(), m.num_cols());
+  const unsigned int* inverse = m_inverse.data();
+  unsigned int band = m.bandwidth();
+
+  //Bandwidth after reordering, from the new positions of the non-zeros
+  unsigned int new_band = 0;
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    for(unsigned int j = (i > band ? i-band : 0); j < i; j++)
+    {
+      if(m(i, j) != 0)
+      {
+        unsigned int a = inverse[i];
+        unsigned int b = inverse[j];
+        unsigned int distance = (a > b ? a-b : b-a);
+        if(distance > new_band)
+          new_band = distance;
+      }
+    }
+  }
+
+  Symmetric_Banded_Matrix<T> result(m_n, new_band);
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    for(unsigned int j = (i > band ? i-band : 0); j <= i; j++)
+    {
+      if(m(i, j) != 0)
+        result.get_elem(inverse[i], inverse[j]) = m(i, j);
+    }
+  }
+  return result;
+}
+
+template <typename T>
+Sparse_Matrix<T> Permutation::apply(const Sparse_Matrix<T>& m) const
+{
+  if(m.num_rows() != m_n || m.num_cols() != m_n)
+    throw MatrixDimError(m.num_rows(), m.num_cols());
+  //Move every stored element to its new place and let the triplet builder
+  //sort the rows again
+  unsigned int count = m.nonzeros();
+  const unsigned int* row_start = m.row_start();
+  const unsigned int* columns = m.col_index();
+  const T* values = m.values();
+  Aligned_Array<unsigned int> rows(count);
+  Aligned_Array<unsigned int> cols(count);
+  Aligned_Array<T> elements(count);
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    for(unsigned int k = row_start[i]; k < row_start[i+1]; k++)
+    {
+      rows[k] = m_inverse[i];
+      cols[k] = m_inverse[columns[k]];
+      elements[k] = values[k];
+    }
+  }
+  return Sparse_Matrix<T>(m_n, m_n, rows, cols, elements);
+}
@@ -0,0 +1,114 @@
+#ifndef POISSON_STENCIL_MATRIX_H
+#define POISSON_STENCIL_MATRIX_H
+/**
+ *  @file poisson_stencil_matrix.h
+ *  @brief Class defintion for poisson stencil matrix
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <iostream>
+#include "vector.h"
+#include "abstract_matrix.h"
+
+//Forward declare class
+template <typename T>
+class Matrix;
+
+///
+/// \class Poisson_Stencil_Matrix
+/// \brief This class acts as the finite difference matrix of the Poisson
+///        equation on a square grid, 1 on the diagonal and -0.25 for each of
+///        the four neighbours of a point. No elements are stored, they are
+///        computed from the number of divisions when they are needed, and
+///        the product with a vector applies the stencil directly.
+///
+
+template <typename T>
+class Poisson_Stencil_Matrix : public Abstract_Matrix<T>
+{
+private:
+  unsigned int m_side; //!< number of interior points along one side of the grid
+  unsigned int m_n; //!< number of rows and cols of the matrix, m_side*m_side
+public:
+  //! Default Constructor
+  /// \pre None
+  /// \post Creates matrix with no elements
+  Poisson_Stencil_Matrix():m_side(0),m_n(0){}
+  //! Constructor
+  /// \pre numDivs > 0
+  /// \post Creates the matrix of a grid cut into numDivs divisions per side, which is (numDivs-1)^2 x (numDivs-1)^2
+  /// @param numDivs of type unsigned int
+  Poisson_Stencil_Matrix(unsigned int numDivs);
+  //! Addition operator for any other type of matrix
+  /// \pre calling object and m must be of equal dimension. Operator+ for (T+T) must be defined
+  /// \post returns the sum of the matrcies. Throws error if m and the calling object are of not equal dimension
+  /// @param m of type const Abstract_Matrix<T>&
+  virtual Matrix<T> operator+(const Abstract_Matrix<T>& m) const;
+  //! Substraction operator for and other type of matrix
+  /// \pre calling object and m must be of equal dimension. Operator- for (T-T) must be defined
+  /// \post returns the difference of the matricies. throws error if m and the calling object do not have the same dimension
+  /// @param m of type const Abstract_Matrix<T>&
+  virtual Matrix<T> operator-(const Abstract_Matrix<T>& m) const;
+  //! Matrix multiplcaiton operator for any matrix
+  /// \pre num_cols() for the calling object is equal to the number of rows in m
+  /// \post Returns the product of the matrcies, one stencil application per column of m. Throws error if the number fo columns in the calling object are not equal to the rows in m
+  /// @param m of type Abstract_Matrix<T>&
+  virtual Matrix<T> operator*(const Abstract_Matrix<T>& m) const;
+  //! Vector multiplcaiton operator
+  /// \pre size of v must be the same as the number of columns in the matrix
+  /// \post returns the vector b of Ax = b, found by applying the stencil at every grid point. Throws error if the size of v is not the same as the number of columns in the matrix
+  /// @param v of type const Vector<T>&
+  virtual Vector<T> operator*(const Vector<T>& v) const;
+  //! Get a column vector
+  /// \pre 0 <= index < num_cols()
+  /// \post returns the column vector at the index. Throws error if the inequality in the precondition is not satisfied
+  /// @param index of type unsigned int
+  virtual Vector<T> col_vector(unsigned int index) const;
+  //! Return the number of rows in the matrix
+  /// \pre None
+  /// \post Returns the number of rows in the matrix
+  virtual unsigned int num_rows() const;
+  //! Return the number of columns in the matrix
+  /// \pre None
+  /// \post Returns the number of columns in the matrix
+  virtual unsigned int num_cols() const;
+  //! Return the number of interior points along one side of the grid
+  /// \pre None
+  /// \post Returns the side of the grid, row i of the matrix is point (i/side, i%side)
+  unsigned int side() const;
+  //! Indexing operator
+  /// \pre 0 <= row < num_rows() and 0 <= col < num_cols()
+  /// \post Return the the specified index. Throws error if either inequalities in the pre condtiion are not satisfied
+  /// @param row of type unsigned int
+  /// @param col of type unsigned int
+  virtual T operator()(unsigned int row, unsigned int col) const;
+  //! Returns a reference to an element
+  /// \pre None, the elements are not stored so none can be modified
+  /// \post Always throws error
+  /// @param row of type unsigned int
+  /// @param col of type unsigned int
+  virtual T& get_elem(unsigned int row, unsigned int col);
+
+  //! Extration operator
+  /// \pre None
+  /// \post places elements in stream and returns it
+  /// @param os of type ostream&
+  /// @param m of type const Poisson_Stencil_Matrix<T>&
+  friend std::ostream& operator<<(std::ostream& os, const Poisson_Stencil_Matrix<T>& m)
+  {
+    for(unsigned int i = 0; i < m.m_n; i++)
+    {
+      for(unsigned int j = 0; j < m.m_n; j++)
+      {
+        os << m(i, j) << " ";
+      }
+      os << std::endl;
+    }
+    return os;
+  }
+};
+
+#include "poisson_stencil_matrix.hpp"
+
+#endif
@@ -0,0 +1,174 @@
+/**
+ *  @file poisson_stencil_matrix.hpp
+ *  @brief Class implmentation for poisson stencil matrix
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "vector.h"
+#include "matrix.h"
+#include "RangeError.h"
+#include "MatrixDimError.h"
+#include "ModificationError.h"
+#include "thread_pool.h"
+
+template <typename T>
+Poisson_Stencil_Matrix<T>::Poisson_Stencil_Matrix(unsigned int numDivs)
+{
+  m_side = (numDivs > 0 ? numDivs-1 : 0);
+  m_n = m_side*m_side;
+}
+
+template <typename T>
+Matrix<T> Poisson_Stencil_Matrix<T>::operator+(const Abstract_Matrix<T>& m) const
+{
+  if(m_n != m.num_rows() || m_n != m.num_cols())
+    throw MatrixDimError(m_n, m_n);
+  Matrix<T> temp(m_n, m_n);
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    for(unsigned int j = 0; j < m_n; j++)
+    {
+      temp.get_elem(i, j) = operator()(i, j) + m(i, j);
+    }
+  }
+  return temp;
+}
+
+template <typename T>
+Matrix<T> Poisson_Stencil_Matrix<T>::operator-(const Abstract_Matrix<T>& m) const
+{
+  if(m_n != m.num_rows() || m_n != m.num_cols())
+    throw MatrixDimError(m_n, m_n);
+  Matrix<T> temp(m_n, m_n);
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    for(unsigned int j = 0; j < m_n; j++)
+    {
+      temp.get_elem(i, j) = operator()(i, j) - m(i, j);
+    }
+  }
+  return temp;
+}
+
+template <typename T>
+Matrix<T> Poisson_Stencil_Matrix<T>::operator*(const Abstract_Matrix<T>& m) const
+{
+  if(m_n != m.num_rows())
+    throw MatrixDimError(m.num_rows(), m_n);
+  Matrix<T> result(m_n, m.num_cols());
+  for(unsigned int j = 0; j < m.num_cols(); j++)
+    result.set_col(j, (*this)*m.col_vector(j));
+  return result;
+}
+
+template <typename T>
+Vector<T> Poisson_Stencil_Matrix<T>::operator*(const Vector<T>& v) const
+{
+  if(m_n != v.size())
+    throw MatrixDimError(m_n, m_n);
+  Vector<T> temp(m_n);
+  const T quarter = static_cast<T>(0.25);
+  const T* x = v.data();
+  T* y = temp.data();
+  //Point (r, c) of the grid is entry r*m_side+c, its neighbours above and
+  //below are a whole grid row away. Every grid row is a contiguous run, so
+  //the inner loops stream through x and y. Bands of grid rows go to the pool
+  unsigned int side = m_side;
+  Thread_Pool::shared().parallel_for(0, m_side, Thread_Pool::grain(m_side), [x, y, side, quarter](unsigned int first, unsigned int last)
+  {
+    for(unsigned int r = first; r < last; r++)
+    {
+      const T* row = x + r*side;
+      T* out = y + r*side;
+      for(unsigned int c = 0; c < side; c++)
+        out[c] = row[c];
+      for(unsigned int c = 1; c < side; c++)
+        out[c] -= quarter*row[c-1];
+      for(unsigned int c = 0; c+1 < side; c++)
+        out[c] -= quarter*row[c+1];
+      if(r > 0)
+      {
+        const T* below = row - side;
+        for(unsigned int c = 0; c < side; c++)
+          out[c] -= quarter*below[c];
+      }
+      if(r+1 < side)
+      {
+        const T* above = row + side;
+        for(unsigned int c = 0; c < side; c++)
+          out[c] -= quarter*above[c];
+      }
+    }
+  });
+  return temp;
+}
+
+template <typename T>
+Vector<T> Poisson_Stencil_Matrix<T>::col_vector(unsigned int index) const
+{
+  if(index >= m_n)
+    throw RangeError(index);
+  //Symmetric, so the column is the row, which only has the point and its neighbours
+  Vector<T> temp(m_n);
+  const T neighbour = static_cast<T>(-0.25);
+  unsigned int r = index / m_side;
+  unsigned int c = index % m_side;
+  temp[index] = 1;
+  if(c > 0)
+    temp[index-1] = neighbour;
+  if(c+1 < m_side)
+    temp[index+1] = neighbour;
+  if(r > 0)
+    temp[index-m_side] = neighbour;
+  if(r+1 < m_side)
+    temp[index+m_side] = neighbour;
+  return temp;
+}
+
+template <typename T>
+unsigned int Poisson_Stencil_Matrix<T>::num_rows() const
+{
+  return m_n;
+}
+
+template <typename T>
+unsigned int Poisson_Stencil_Matrix<T>::num_cols() const
+{
+  return m_n;
+}
+
+template <typename T>
+unsigned int Poisson_Stencil_Matrix<T>::side() const
+{
+  return m_side;
+}
+
+template <typename T>
+T Poisson_Stencil_Matrix<T>::operator()(unsigned int row, unsigned int col) const
+{
+  if(row >= m_n)
+    throw RangeError(row);
+  if(col >= m_n)
+    throw RangeError(col);
+
+  if(row == col)
+    return 1;
+  unsigned int low = (row < col ? row : col);
+  unsigned int high = (row < col ? col : row);
+  //Neighbours in the same grid row, or in the grid rows above and below
+  if((high-low == 1 && high % m_side != 0) || high-low == m_side)
+    return static_cast<T>(-0.25);
+  return 0;
+}
+
+template <typename T>
+T& Poisson_Stencil_Matrix<T>::get_elem(unsigned int row, unsigned int col)
+{
+  if(row >= m_n)
+    throw RangeError(row);
+  if(col >= m_n)
+    throw RangeError(col);
+  //The elements are never stored, so there is nothing to refer to
+  throw ModificationError();
+}
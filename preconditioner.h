@@ -0,0 +1,38 @@
+#ifndef PRECONDITIONER_H
+#define PRECONDITIONER_H
+/**
+ *  @file preconditioner.h
+ *  @brief Class defintion for preconditioner
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "vector.h"
+
+///
+/// \class Preconditioner
+/// \brief This class is an interface base class for preconditioners. A
+///        preconditioner stands for a matrix M close to the system matrix
+///        whose systems Mz = r are cheap to solve
+///
+
+template <typename T>
+class Preconditioner
+{
+public:
+  //! Destructor
+  /// \pre None
+  /// \post Preconditioner is destroyed
+  virtual ~Preconditioner(){}
+  //! Function Operator
+  /// \pre size of r matches the size of the preconditioner
+  /// \post Returns z of Mz = r. Throws error if the sizes do not match
+  /// @param r of type const Vector<T>&
+  virtual Vector<T> operator()(const Vector<T>& r) const = 0;
+  //! Returns the size of the preconditioner
+  /// \pre None
+  /// \post Returns the number of rows (and cols) of M
+  virtual unsigned int size() const = 0;
+};
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef RED_BLACK_SOR_H
+#define RED_BLACK_SOR_H
+
+/**
+ *  @file red_black_sor.h
+ *  @brief Class defintion for red black sor
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "vector.h"
+
+///
+/// \class Red_Black_SOR
+/// \brief This class is successive over-relaxation for the finite difference
+///        system of FiniteDiff, u - 0.25*(sum of the four neighbours) = f on
+///        a square grid of numDivs divisions per side. Points with even r+c
+///        (red) only depend on points with odd r+c (black) and the other way
+///        around, so each colour is updated all at once, split into bands of
+///        grid rows on the shared Thread_Pool. The relaxation factor is the
+///        optimal 2/(1+sin(h)) for the grid spacing h = pi/numDivs
+///
+
+template <typename T>
+class Red_Black_SOR
+{
+private:
+  unsigned int m_numDivs; //!< divisions per side of the grid
+  unsigned int m_side; //!< points per side of the grid, m_numDivs-1
+  T m_omega; //!< relaxation factor
+  //! Relaxes one colour over a band of rows
+  /// \pre u and f hold the points of the grid, first <= last <= m_side
+  /// \post The points of colour color in rows first to last-1 are relaxed
+  void sweep(T* u, const T* f, unsigned int color, unsigned int first, unsigned int last) const;
+  //! Residual over a band of rows
+  /// \pre u and f hold the points of the grid, first <= last <= m_side
+  /// \post Returns the sum of the squared residuals of rows first to last-1
+  double residual(const T* u, const T* f, unsigned int first, unsigned int last) const;
+public:
+  //! Constructor
+  /// \pre numDivs > 0
+  /// \post Red_Black_SOR object created for a grid with numDivs divisions per side
+  /// @param numDivs of type unsigned int
+  Red_Black_SOR(unsigned int numDivs);
+  //! Function Operator
+  /// \pre f holds the (numDivs-1)^2 points of the grid. tolerance > 0
+  /// \post Returns u of Au = f, iterating from u = 0 until the residual norm is at most tolerance times the norm of f. The residual is checked every 10 iterations. Throws error if the size of f does not match or if the tolerance is not reached within maxIterations
+  /// @param f of type const Vector<T>&
+  /// @param tolerance of type double
+  /// @param maxIterations of type unsigned int
+  Vector<T> operator()(const Vector<T>& f, double tolerance = 1.0E-10, unsigned int maxIterations = 100000) const;
+  //! Relaxation factor
+  /// \pre None
+  /// \post Returns the relaxation factor used
+  T omega() const;
+};
+
+#include "red_black_sor.hpp"
+
+#endif
@@ -0,0 +1,120 @@
+/**
+ *  @file red_black_sor.hpp
+ *  @brief Class implmentation for red black sor
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <math.h>
+#include <functional>
+#include "vector.h"
+#include "DimensionError.h"
+#include "ConvergenceError.h"
+#include "parallel_kernels.h"
+#include "thread_pool.h"
+
+template <typename T>
+Red_Black_SOR<T>::Red_Black_SOR(unsigned int numDivs)
+  :m_numDivs(numDivs),m_side(numDivs > 0 ? numDivs-1 : 0)
+{
+  double h = M_PI/(numDivs > 0 ? numDivs : 1);
+  m_omega = static_cast<T>(2/(1+sin(h)));
+}
+
+template <typename T>
+void Red_Black_SOR<T>::sweep(T* u, const T* f, unsigned int color, unsigned int first, unsigned int last) const
+{
+  const T quarter = static_cast<T>(0.25);
+  const T keep = 1-m_omega;
+  for(unsigned int r = first; r < last; r++)
+  {
+    T* row = u + r*m_side;
+    const T* rhs = f + r*m_side;
+    const T* below = (r > 0 ? row-m_side : nullptr);
+    const T* above = (r+1 < m_side ? row+m_side : nullptr);
+    for(unsigned int c = (r+color) % 2; c < m_side; c += 2)
+    {
+      T sum = 0;
+      if(c > 0)
+        sum += row[c-1];
+      if(c+1 < m_side)
+        sum += row[c+1];
+      if(below != nullptr)
+        sum += below[c];
+      if(above != nullptr)
+        sum += above[c];
+      row[c] = keep*row[c] + m_omega*(rhs[c] + quarter*sum);
+    }
+  }
+}
+
+template <typename T>
+double Red_Black_SOR<T>::residual(const T* u, const T* f, unsigned int first, unsigned int last) const
+{
+  const T quarter = static_cast<T>(0.25);
+  double total = 0;
+  for(unsigned int r = first; r < last; r++)
+  {
+    const T* row = u + r*m_side;
+    const T* rhs = f + r*m_side;
+    const T* below = (r > 0 ? row-m_side : nullptr);
+    const T* above = (r+1 < m_side ? row+m_side : nullptr);
+    for(unsigned int c = 0; c < m_side; c++)
+    {
+      T sum = 0;
+      if(c > 0)
+        sum += row[c-1];
+      if(c+1 < m_side)
+        sum += row[c+1];
+      if(below != nullptr)
+        sum += below[c];
+      if(above != nullptr)
+        sum += above[c];
+      double res = rhs[c] - row[c] + quarter*sum;
+      total += res*res;
+    }
+  }
+  return total;
+}
+
+template <typename T>
+Vector<T> Red_Black_SOR<T>::operator()(const Vector<T>& f, double tolerance, unsigned int maxIterations) const
+{
+  if(f.size() != m_side*m_side)
+    throw DimensionError(f.size());
+  Vector<T> u(f.size());
+  T* points = u.data();
+  const T* rhs = f.data();
+  Thread_Pool& pool = Thread_Pool::shared();
+  //Bands of rows of one colour are independent, each is a task of the pool
+  unsigned int grain = Thread_Pool::grain(m_side);
+  auto total_residual = [this, &pool, grain, points, rhs]
+  {
+    return pool.parallel_reduce(0, m_side, grain, 0.0,
+      [this, points, rhs](unsigned int first, unsigned int last){ return residual(points, rhs, first, last); },
+      std::plus<double>());
+  };
+  double stop = tolerance*tolerance*Parallel_Kernels<T>::dot(rhs, rhs, f.size());
+  if(total_residual() <= stop)
+    return u;
+
+  for(unsigned int k = 0; k < maxIterations; k++)
+  {
+    for(unsigned int color = 0; color < 2; color++)
+    {
+      pool.parallel_for(0, m_side, grain, [this, points, rhs, color](unsigned int first, unsigned int last)
+      {
+        sweep(points, rhs, color, first, last);
+      });
+    }
+    if((k % 10 == 9 || k+1 == maxIterations) && total_residual() <= stop)
+      return u;
+  }
+  throw ConvergenceError();
+}
+
+template <typename T>
+T Red_Black_SOR<T>::omega() const
+{
+  return m_omega;
+}
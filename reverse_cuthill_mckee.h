@@ -0,0 +1,59 @@
+#ifndef REVERSE_CUTHILL_MCKEE_H
+#define REVERSE_CUTHILL_MCKEE_H
+
+/**
+ *  @file reverse_cuthill_mckee.h
+ *  @brief Class defintion for reverse cuthill mckee
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "Aligned_Array.h"
+#include "abstract_matrix.h"
+#include "symmetric_banded_matrix.h"
+#include "sparse_matrix.h"
+#include "adjacency_graph.h"
+#include "permutation.h"
+
+///
+/// \class Reverse_Cuthill_McKee
+/// \brief This class is the reverse Cuthill-McKee bandwidth reducing ordering
+///        implemented as a class. The pattern of the matrix is read as an
+///        undirected graph. Each connected component is numbered breadth first
+///        from a pseudo-peripheral node, the neighbours of a node in order of
+///        increasing degree, and the final order is reversed.
+///
+
+template <typename T>
+class Reverse_Cuthill_McKee
+{
+public:
+  //! Constructor
+  /// \pre None
+  /// \post Functor Reverse_Cuthill_McKee object created
+  Reverse_Cuthill_McKee(){}
+  //! Function Operator on a graph
+  /// \pre None
+  /// \post Returns the reverse Cuthill-McKee order of the nodes of g
+  /// @param g of type const Adjacency_Graph&
+  Permutation operator()(const Adjacency_Graph& g) const;
+  //! Function Operator
+  /// \pre m is square. Comparison to 0 must be defined for T
+  /// \post Returns the reverse Cuthill-McKee order of the pattern of m + m^T. Throws error if m is not square
+  /// @param m of type const Abstract_Matrix<T>&
+  Permutation operator()(const Abstract_Matrix<T>& m) const;
+  //! Function Operator for banded matrices
+  /// \pre Comparison to 0 must be defined for T
+  /// \post Returns the reverse Cuthill-McKee order of the pattern of m, reading only the band
+  /// @param m of type const Symmetric_Banded_Matrix<T>&
+  Permutation operator()(const Symmetric_Banded_Matrix<T>& m) const;
+  //! Function Operator for sparse matrices
+  /// \pre m is square. Comparison to 0 must be defined for T
+  /// \post Returns the reverse Cuthill-McKee order of the pattern of m + m^T, reading only the stored elements. Throws error if m is not square
+  /// @param m of type const Sparse_Matrix<T>&
+  Permutation operator()(const Sparse_Matrix<T>& m) const;
+};
+
+#include "reverse_cuthill_mckee.hpp"
+
+#endif
@@ -0,0 +1,76 @@
+/**
+ *  @file reverse_cuthill_mckee.hpp
+ *  @brief Class implmentation for reverse cuthill mckee
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <algorithm>
+
+template <typename T>
+Permutation Reverse_Cuthill_McKee<T>::operator()(const Adjacency_Graph& g) const
+{
+  unsigned int n = g.size();
+  const unsigned int* first = g.start();
+  const unsigned int* neighbours = g.adjacent();
+
+  Aligned_Array<unsigned int> order(n);
+  Aligned_Array<unsigned int> queue(n);
+  Aligned_Array<unsigned int> mark(n);
+  Aligned_Array<unsigned int> level(n);
+  Aligned_Array<unsigned char> numbered(n);
+  unsigned int stamp = 1;
+  unsigned int count = 0;
+
+  auto by_degree = [first](unsigned int a, unsigned int b)
+  {
+    return first[a+1]-first[a] < first[b+1]-first[b];
+  };
+
+  for(unsigned int seed = 0; seed < n; seed++)
+  {
+    if(numbered[seed])
+      continue;
+    //Number the component of seed breadth first, using order itself as the queue
+    unsigned int head = count;
+    unsigned int reached, depth;
+    unsigned int root = g.peripheral_node(seed, nullptr, mark.data(), stamp, level.data(), queue.data(), reached, depth);
+    order[count++] = root;
+    numbered[root] = 1;
+    while(head < count)
+    {
+      unsigned int node = order[head++];
+      unsigned int begin = count;
+      for(unsigned int k = first[node]; k < first[node+1]; k++)
+      {
+        if(!numbered[neighbours[k]])
+        {
+          numbered[neighbours[k]] = 1;
+          order[count++] = neighbours[k];
+        }
+      }
+      std::stable_sort(order.data()+begin, order.data()+count, by_degree);
+    }
+  }
+
+  std::reverse(order.data(), order.data()+n);
+  return Permutation(order);
+}
+
+template <typename T>
+Permutation Reverse_Cuthill_McKee<T>::operator()(const Abstract_Matrix<T>& m) const
+{
+  return (*this)(Adjacency_Graph(m));
+}
+
+template <typename T>
+Permutation Reverse_Cuthill_McKee<T>::operator()(const Symmetric_Banded_Matrix<T>& m) const
+{
+  return (*this)(Adjacency_Graph(m));
+}
+
+template <typename T>
+Permutation Reverse_Cuthill_McKee<T>::operator()(const Sparse_Matrix<T>& m) const
+{
+  return (*this)(Adjacency_Graph(m));
+}
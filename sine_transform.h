@@ -0,0 +1,48 @@
+#ifndef SINE_TRANSFORM_H
+#define SINE_TRANSFORM_H
+
+/**
+ *  @file sine_transform.h
+ *  @brief Class defintion for sine transform
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "fft.h"
+
+///
+/// \class Sine_Transform
+/// \brief This class is the type I discrete sine transform of a fixed length m,
+///        X[k-1] = sum over j = 1..m of x[j-1]*sin(pi*j*k/(m+1)). Applying it
+///        twice gives back the input times (m+1)/2. The odd extension of the
+///        input is transformed with an FFT of length 2(m+1), and two real
+///        sequences are carried through each complex FFT
+///
+
+template <typename T>
+class Sine_Transform
+{
+private:
+  unsigned int m_m; //!< length of the transform
+  FFT<T> m_fft; //!< FFT of the odd extension, length 2(m+1)
+public:
+  //! Constructor
+  /// \pre None
+  /// \post Sine_Transform object of length m created
+  /// @param m of type unsigned int
+  Sine_Transform(unsigned int m = 0);
+  //! Function Operator
+  /// \pre a points to m elements, b is null or points to m other elements
+  /// \post a, and b when it is not null, hold their sine transforms
+  /// @param a of type T*
+  /// @param b of type T*
+  void operator()(T* a, T* b = nullptr) const;
+  //! Returns the length of the transform
+  /// \pre None
+  /// \post Returns m
+  unsigned int size() const;
+};
+
+#include "sine_transform.hpp"
+
+#endif
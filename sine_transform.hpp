@@ -0,0 +1,48 @@
+/**
+ *  @file sine_transform.hpp
+ *  @brief Class implmentation for sine transform
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <complex>
+#include "fft.h"
+#include "Aligned_Array.h"
+
+template <typename T>
+Sine_Transform<T>::Sine_Transform(unsigned int m):m_m(m),m_fft(m > 0 ? 2*(m+1) : 0)
+{
+}
+
+template <typename T>
+void Sine_Transform<T>::operator()(T* a, T* b) const
+{
+  if(m_m == 0)
+    return;
+  unsigned int length = 2*(m_m+1);
+  //y = a + ib, extended to be odd about 0 and m+1. The transform of the odd
+  //extension of a real x is -2i times its sine transform, so a ends up in
+  //the imaginary part and b in the real part
+  Aligned_Array<std::complex<T>> work(length);
+  std::complex<T>* y = work.data();
+  for(unsigned int j = 1; j <= m_m; j++)
+  {
+    std::complex<T> value(a[j-1], (b != nullptr ? b[j-1] : 0));
+    y[j] = value;
+    y[length-j] = -value;
+  }
+  m_fft.forward(y);
+  T half = static_cast<T>(0.5);
+  for(unsigned int k = 1; k <= m_m; k++)
+  {
+    a[k-1] = -half*y[k].imag();
+    if(b != nullptr)
+      b[k-1] = half*y[k].real();
+  }
+}
+
+template <typename T>
+unsigned int Sine_Transform<T>::size() const
+{
+  return m_m;
+}
@@ -0,0 +1,147 @@
+#ifndef SPARSE_CHOLESKY_H
+#define SPARSE_CHOLESKY_H
+
+/**
+ *  @file sparse_cholesky.h
+ *  @brief Class defintion for sparse cholesky
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "Aligned_Array.h"
+#include "vector.h"
+#include "sparse_matrix.h"
+#include "permutation.h"
+
+///
+/// \class Sparse_Cholesky
+/// \brief This class is a supernodal sparse cholesky factorization. The
+///        symbolic phase, analyze(), reorders the unknowns, builds the
+///        elimination tree and the column counts of L, and groups columns
+///        with the same structure into supernodes. Each supernode is stored
+///        as a dense panel of its rows of L, so the numeric phase, factor(),
+///        works with dense kernels on whole panels. The analysis is kept, and
+///        reused by factor() for any matrix with the same pattern. The
+///        analysis also splits the supernode tree into tasks, whole subtrees
+///        at the bottom and chains of supernodes above them, and sorts the
+///        tasks into levels, so solve() runs the tasks of a level at the same
+///        time on the shared pool.
+///
+
+template <typename T>
+class Sparse_Cholesky
+{
+private:
+  unsigned int m_n; //!< number of rows and cols of the analyzed matrix
+  bool m_analyzed; //!< true once analyze() has been called
+  bool m_factored; //!< true once factor() has finished for the current analysis
+  Permutation m_order; //!< fill reducing order followed by a postorder of the elimination tree
+  Aligned_Array<unsigned int> m_patternStart; //!< row starts of the analyzed pattern
+  Aligned_Array<unsigned int> m_patternColumns; //!< columns of the analyzed pattern
+  Aligned_Array<unsigned int> m_parent; //!< parent of each column in the elimination tree, m_n for a root
+  unsigned int m_supernodes; //!< number of supernodes
+  Aligned_Array<unsigned int> m_superStart; //!< first column of each supernode, with one more for the end
+  Aligned_Array<unsigned int> m_columnSuper; //!< supernode of each column
+  Aligned_Array<unsigned int> m_rowStart; //!< position of the first row of each supernode in m_rows
+  Aligned_Array<unsigned int> m_rows; //!< rows of L in each supernode, its own columns first and then the rows below in increasing order
+  Aligned_Array<unsigned int> m_valueStart; //!< position of the panel of each supernode in m_values
+  Aligned_Array<T> m_values; //!< panels of L, each row major with a row per entry of m_rows and a column per column of the supernode
+  unsigned int m_levels; //!< number of levels of the solve tasks
+  Aligned_Array<unsigned int> m_levelStart; //!< position of the first task of each level, with one more for the end
+  Aligned_Array<unsigned int> m_taskFirst; //!< first supernode of each task by level, the supernodes of a task are consecutive
+  Aligned_Array<unsigned int> m_taskLast; //!< one past the last supernode of each task by level
+  Aligned_Array<unsigned int> m_levelGrain; //!< tasks of each level worth running on a thread of their own
+  Aligned_Array<unsigned int> m_updateStart; //!< position of the first update of each supernode in m_updateSuper, m_updateFirst and m_updateLast
+  Aligned_Array<unsigned int> m_updateSuper; //!< supernode of an earlier solve task with rows in the columns of the supernode, in increasing order
+  Aligned_Array<unsigned int> m_updateFirst; //!< first of those rows in the panel of the supernode below, the rows are consecutive
+  Aligned_Array<unsigned int> m_updateLast; //!< one past the last of those rows
+  //! Checks if a matrix has the analyzed pattern
+  /// \pre None
+  /// \post Returns true if m stores exactly the elements of the analyzed matrix
+  bool same_pattern(const Sparse_Matrix<T>& m) const;
+  //! Places the elements of a matrix in the panels
+  /// \pre m has the analyzed pattern. map has m_n elements
+  /// \post Each panel holds the elements of its columns of the reordered m, and zero where L fills in
+  void assemble(const Sparse_Matrix<T>& m, unsigned int* map);
+  //! Factors one supernode
+  /// \pre Every update from the supernodes before s has been applied to its panel
+  /// \post The panel of s holds its columns of L. Throws error if a pivot is not positive
+  void factor_supernode(unsigned int s);
+  //! Applies the updates of one supernode
+  /// \pre s has been factored. map has m_n elements, scratch has room for the square of the number of rows of s below its columns
+  /// \post The outer product of the rows of s below its columns is subtracted from the panels of the supernodes that own those rows
+  void update_ancestors(unsigned int s, unsigned int* map, T* scratch);
+  //! Builds the levels and updates used by solve()
+  /// \pre The supernodes and their rows have been computed
+  /// \post The tasks of solve() are grouped by level, subtrees small enough to be one task on level 0, a supernode above them with one child in the task of that child, and every other supernode starting a task one level above its highest child. m_updateStart, m_updateSuper, m_updateFirst and m_updateLast list for each supernode the panel rows of earlier tasks that hold its columns
+  void analyze_levels();
+  //! Forward solve of one supernode
+  /// \pre y holds the reordered right hand side, with the forward solve done for every supernode below s in the tree. s belongs to the solve task that ends before supernode end
+  /// \post The entries of y for the columns of s hold their values of the solve with L, and the rows of s owned by supernodes of its task have been updated. No other entry is written
+  /// @param s of type unsigned int
+  /// @param end of type unsigned int
+  /// @param y of type T*
+  void forward_supernode(unsigned int s, unsigned int end, T* y) const;
+  //! Backward solve of one supernode
+  /// \pre y holds the result of the forward solve, with the backward solve done for every supernode above s in the tree
+  /// \post The entries of y for the columns of s hold their values of the solve with L^T. Only those entries are written
+  /// @param s of type unsigned int
+  /// @param y of type T*
+  void backward_supernode(unsigned int s, T* y) const;
+public:
+  //! Constructor
+  /// \pre None
+  /// \post Sparse_Cholesky object created, with no analysis and no factor
+  Sparse_Cholesky():m_n(0),m_analyzed(false),m_factored(false),m_supernodes(0),m_levels(0){}
+  //! Symbolic analysis with a given order
+  /// \pre m is square with a symmetric pattern, both triangles stored. order has as many unknowns as m
+  /// \post The structure of L for the order is computed and kept, any old factor is dropped. Throws error if m is not square or order does not match
+  /// @param m of type const Sparse_Matrix<T>&
+  /// @param order of type const Permutation&
+  void analyze(const Sparse_Matrix<T>& m, const Permutation& order);
+  //! Symbolic analysis
+  /// \pre m is square with a symmetric pattern, both triangles stored
+  /// \post As for analyze(m, order), with the order chosen by Nested_Dissection
+  /// @param m of type const Sparse_Matrix<T>&
+  void analyze(const Sparse_Matrix<T>& m);
+  //! Numeric factorization
+  /// \pre m is symmetric positive definite, both triangles stored
+  /// \post The calling object holds L with PmP^T = L(L^T). The analysis is reused if m has its pattern, and m is analyzed again otherwise. Throws error if m is not positive definite or is singular
+  /// @param m of type const Sparse_Matrix<T>&
+  void factor(const Sparse_Matrix<T>& m);
+  //! Solve with the kept factor
+  /// \pre factor() has been called. The size of b matches the rows of the factored matrix
+  /// \post Returns x of mx = b. Throws error if the sizes do not match or there is no factor
+  /// @param b of type const Vector<T>&
+  Vector<T> solve(const Vector<T>& b) const;
+  //! Function Operator
+  /// \pre m is symmetric positive definite with both triangles stored, and its size matches the size of b
+  /// \post Solves the system mx=b, returning x. Throws error if the sizes do not match or m is not positive definite
+  /// @param m of type const Sparse_Matrix<T>&
+  /// @param b of type const Vector<T>&
+  Vector<T> operator()(const Sparse_Matrix<T>& m, const Vector<T>& b) const;
+  //! Returns the number of unknowns
+  /// \pre None
+  /// \post Returns the number of rows of the analyzed matrix
+  unsigned int size() const;
+  //! Returns the number of supernodes
+  /// \pre None
+  /// \post Returns the number of supernodes of the analysis
+  unsigned int supernodes() const;
+  //! Returns the number of levels
+  /// \pre None
+  /// \post Returns the number of levels of the solve tasks, the number of steps of each sweep of solve()
+  unsigned int levels() const;
+  //! Returns the size of L
+  /// \pre None
+  /// \post Returns the number of elements of L on or below the diagonal that may be non-zero
+  unsigned int nonzeros() const;
+  //! Returns the order
+  /// \pre None
+  /// \post Returns the order of the unknowns used by the factor
+  const Permutation& order() const;
+};
+
+#include "sparse_cholesky.hpp"
+
+#endif
@@ -0,0 +1,655 @@
+/**
+ *  @file sparse_cholesky.hpp
+ *  @brief Class implmentation for sparse cholesky
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <math.h>
+#include <algorithm>
+#include "nested_dissection.h"
+#include "vector_kernels.h"
+#include "tile_kernels.h"
+#include "thread_pool.h"
+#include "DimensionError.h"
+#include "MatrixDimError.h"
+#include "SingularError.h"
+
+template <typename T>
+void Sparse_Cholesky<T>::analyze(const Sparse_Matrix<T>& m, const Permutation& order)
+{
+  if(m.num_rows() != m.num_cols())
+    throw MatrixDimError(m.num_rows(), m.num_cols());
+  if(order.size() != m.num_rows())
+    throw DimensionError(order.size());
+  unsigned int n = m.num_rows();
+  const unsigned int* start = m.row_start();
+  const unsigned int* columns = m.col_index();
+
+  //Elimination tree of the reordered matrix, by Liu's method with path
+  //compression. Row j of L reaches every column on the tree paths from the
+  //columns of row j of the matrix up to j
+  Aligned_Array<unsigned int> parent(n);
+  Aligned_Array<unsigned int> ancestor(n);
+  for(unsigned int j = 0; j < n; j++)
+  {
+    parent[j] = n;
+    ancestor[j] = n;
+    unsigned int old = order[j];
+    for(unsigned int k = start[old]; k < start[old+1]; k++)
+    {
+      unsigned int i = order.inverse(columns[k]);
+      while(i < j)
+      {
+        unsigned int next = ancestor[i];
+        ancestor[i] = j;
+        if(next == n)
+        {
+          parent[i] = j;
+          break;
+        }
+        i = next;
+      }
+    }
+  }
+
+  //Postorder the tree, so every subtree is a run of consecutive columns
+  //and the columns of a supernode are next to each other
+  Aligned_Array<unsigned int> head(n);
+  Aligned_Array<unsigned int> next(n);
+  Aligned_Array<unsigned int> stack(n);
+  Aligned_Array<unsigned int> post(n);
+  for(unsigned int j = 0; j < n; j++)
+    head[j] = n;
+  for(unsigned int j = n; j > 0; j--)
+  {
+    //Adding the children from the back keeps them in increasing order
+    if(parent[j-1] != n)
+    {
+      next[j-1] = head[parent[j-1]];
+      head[parent[j-1]] = j-1;
+    }
+  }
+  unsigned int count = 0;
+  for(unsigned int root = 0; root < n; root++)
+  {
+    if(parent[root] != n)
+      continue;
+    unsigned int top = 0;
+    stack[top++] = root;
+    while(top > 0)
+    {
+      unsigned int node = stack[top-1];
+      if(head[node] == n)
+      {
+        top--;
+        post[count++] = node;
+      }
+      else
+      {
+        stack[top++] = head[node];
+        head[node] = next[head[node]];
+      }
+    }
+  }
+
+  Aligned_Array<unsigned int> combined(n);
+  Aligned_Array<unsigned int> position(n);
+  for(unsigned int k = 0; k < n; k++)
+  {
+    combined[k] = order[post[k]];
+    position[post[k]] = k;
+  }
+  Permutation final_order(combined);
+  m_parent = Aligned_Array<unsigned int>(n);
+  for(unsigned int j = 0; j < n; j++)
+    m_parent[position[j]] = (parent[j] == n ? n : position[parent[j]]);
+  const unsigned int* tree = m_parent.data();
+
+  //Column counts of L. Row j of L is the subtree of the tree spanned by
+  //the columns of row j of the matrix, walked up until a column already
+  //marked for row j
+  Aligned_Array<unsigned int> column_count(n);
+  Aligned_Array<unsigned int> mark(n);
+  Aligned_Array<unsigned int> children(n);
+  for(unsigned int j = 0; j < n; j++)
+  {
+    column_count[j]++;
+    mark[j] = j;
+    if(tree[j] != n)
+      children[tree[j]]++;
+    unsigned int old = final_order[j];
+    for(unsigned int k = start[old]; k < start[old+1]; k++)
+    {
+      for(unsigned int i = final_order.inverse(columns[k]); i < j && mark[i] != j; i = tree[i])
+      {
+        column_count[i]++;
+        mark[i] = j;
+      }
+    }
+  }
+
+  //Fundamental supernodes, a column joins the one before it when it is
+  //that column's only child's parent and its structure is the same less
+  //the diagonal
+  Aligned_Array<unsigned int> column_super(n);
+  unsigned int supernodes = 0;
+  for(unsigned int j = 0; j < n; j++)
+  {
+    if(j == 0 || tree[j-1] != j || children[j] != 1 || column_count[j] != column_count[j-1]-1)
+      supernodes++;
+    column_super[j] = supernodes-1;
+  }
+  Aligned_Array<unsigned int> super_start(supernodes+1);
+  Aligned_Array<unsigned int> row_start(supernodes+1);
+  Aligned_Array<unsigned int> value_start(supernodes+1);
+  for(unsigned int j = n; j > 0; j--)
+    super_start[column_super[j-1]] = j-1;
+  super_start[supernodes] = n;
+  for(unsigned int s = 0; s < supernodes; s++)
+  {
+    unsigned int width = super_start[s+1]-super_start[s];
+    unsigned int height = column_count[super_start[s]];
+    row_start[s+1] = row_start[s] + height;
+    value_start[s+1] = value_start[s] + height*width;
+  }
+
+  //Rows of each supernode, from the matrix and from the supernodes below
+  //it in the supernode tree. Children come before their parent in the
+  //postorder, so their rows are ready when the parent is reached
+  Aligned_Array<unsigned int> rows(row_start[supernodes]);
+  for(unsigned int s = 0; s < supernodes; s++)
+    head[s] = supernodes;
+  for(unsigned int s = supernodes; s > 0; s--)
+  {
+    unsigned int up = tree[super_start[s]-1];
+    if(up != n)
+    {
+      next[s-1] = head[column_super[up]];
+      head[column_super[up]] = s-1;
+    }
+  }
+  for(unsigned int j = 0; j < n; j++)
+    mark[j] = supernodes;
+  for(unsigned int s = 0; s < supernodes; s++)
+  {
+    unsigned int first = super_start[s];
+    unsigned int last = super_start[s+1];
+    unsigned int p = row_start[s];
+    for(unsigned int j = first; j < last; j++)
+    {
+      rows[p++] = j;
+      mark[j] = s;
+    }
+    for(unsigned int j = first; j < last; j++)
+    {
+      unsigned int old = final_order[j];
+      for(unsigned int k = start[old]; k < start[old+1]; k++)
+      {
+        unsigned int i = final_order.inverse(columns[k]);
+        if(i >= last && mark[i] != s)
+        {
+          mark[i] = s;
+          rows[p++] = i;
+        }
+      }
+    }
+    for(unsigned int child = head[s]; child != supernodes; child = next[child])
+    {
+      unsigned int below = row_start[child] + super_start[child+1]-super_start[child];
+      for(unsigned int k = below; k < row_start[child+1]; k++)
+      {
+        if(rows[k] >= last && mark[rows[k]] != s)
+        {
+          mark[rows[k]] = s;
+          rows[p++] = rows[k];
+        }
+      }
+    }
+    std::sort(rows.data()+row_start[s]+(last-first), rows.data()+p);
+  }
+
+  m_n = n;
+  m_order = final_order;
+  m_patternStart = Aligned_Array<unsigned int>(n+1);
+  m_patternColumns = Aligned_Array<unsigned int>(m.nonzeros());
+  for(unsigned int i = 0; i <= n; i++)
+    m_patternStart[i] = start[i];
+  for(unsigned int k = 0; k < m.nonzeros(); k++)
+    m_patternColumns[k] = columns[k];
+  m_supernodes = supernodes;
+  swap(m_superStart, super_start);
+  swap(m_columnSuper, column_super);
+  swap(m_rowStart, row_start);
+  swap(m_rows, rows);
+  swap(m_valueStart, value_start);
+  m_values = Aligned_Array<T>(m_valueStart[supernodes]);
+  analyze_levels();
+  m_analyzed = true;
+  m_factored = false;
+}
+
+template <typename T>
+void Sparse_Cholesky<T>::analyze_levels()
+{
+  //Subtrees are runs of consecutive supernodes in the postorder. Those
+  //with a small enough share of L become one task each, solved in order,
+  //so that a thread keeps the data of a subtree in its cache
+  Aligned_Array<unsigned int> parent(m_supernodes);
+  Aligned_Array<unsigned int> descendant(m_supernodes);
+  Aligned_Array<unsigned int> work(m_supernodes);
+  for(unsigned int s = 0; s < m_supernodes; s++)
+  {
+    unsigned int up = m_parent[m_superStart[s+1]-1];
+    parent[s] = (up == m_n ? m_supernodes : m_columnSuper[up]);
+    descendant[s] = s;
+  }
+  for(unsigned int s = 0; s < m_supernodes; s++)
+  {
+    work[s] += m_valueStart[s+1]-m_valueStart[s];
+    if(parent[s] != m_supernodes)
+    {
+      work[parent[s]] += work[s];
+      descendant[parent[s]] = std::min(descendant[parent[s]], descendant[s]);
+    }
+  }
+  unsigned int total = 0;
+  for(unsigned int s = 0; s < m_supernodes; s++)
+  {
+    if(parent[s] == m_supernodes)
+      total += work[s];
+  }
+  //A few subtrees per thread lets the fast threads steal from the slow
+  //ones. Gathering costs more than scattering, so one thread keeps whole trees
+  unsigned int threads = Thread_Pool::shared().size();
+  unsigned int cut = (threads == 1 ? total : total/(4*threads));
+
+  //A subtree task is on level 0. Above the subtrees a supernode with one
+  //child joins the task of that child, which it could not run beside
+  //anyway, and any other starts a task one level above its highest child.
+  //Children come before their parent, so their tasks are known when it is
+  //reached, and the last child of a supernode is the one just before it
+  Aligned_Array<unsigned int> children(m_supernodes);
+  for(unsigned int s = 0; s < m_supernodes; s++)
+  {
+    if(parent[s] != m_supernodes)
+      children[parent[s]]++;
+  }
+  Aligned_Array<unsigned int> owner(m_supernodes);
+  Aligned_Array<unsigned int> level(m_supernodes);
+  Aligned_Array<unsigned int> first(m_supernodes);
+  Aligned_Array<unsigned int> last(m_supernodes);
+  Aligned_Array<unsigned int> task_work(m_supernodes);
+  Aligned_Array<unsigned int> above(m_supernodes);
+  unsigned int tasks = 0;
+  m_levels = 0;
+  for(unsigned int s = 0; s < m_supernodes; s++)
+  {
+    bool upper = (work[s] > cut);
+    if(!upper && parent[s] != m_supernodes && work[parent[s]] <= cut)
+      continue;
+    unsigned int t;
+    if(upper && children[s] == 1)
+      t = owner[s-1];
+    else
+    {
+      t = tasks++;
+      level[t] = (upper ? above[s] : 0);
+      first[t] = (upper ? s : descendant[s]);
+    }
+    owner[s] = t;
+    last[t] = s+1;
+    task_work[t] += (upper ? m_valueStart[s+1]-m_valueStart[s] : work[s]);
+    if(parent[s] != m_supernodes)
+      above[parent[s]] = std::max(above[parent[s]], level[t]+1);
+    m_levels = std::max(m_levels, level[t]+1);
+  }
+
+  //No task of a level is an ancestor of another on the same level, so they
+  //can be solved at the same time
+  m_levelStart = Aligned_Array<unsigned int>(m_levels+1);
+  m_levelGrain = Aligned_Array<unsigned int>(m_levels);
+  Aligned_Array<unsigned int> level_work(m_levels);
+  for(unsigned int t = 0; t < tasks; t++)
+  {
+    m_levelStart[level[t]+1]++;
+    level_work[level[t]] += task_work[t];
+  }
+  for(unsigned int l = 0; l < m_levels; l++)
+  {
+    m_levelGrain[l] = Thread_Pool::grain(level_work[l]/m_levelStart[l+1]);
+    m_levelStart[l+1] += m_levelStart[l];
+  }
+  m_taskFirst = Aligned_Array<unsigned int>(tasks);
+  m_taskLast = Aligned_Array<unsigned int>(tasks);
+  Aligned_Array<unsigned int> fill(m_levels);
+  for(unsigned int t = 0; t < tasks; t++)
+  {
+    unsigned int k = m_levelStart[level[t]] + fill[level[t]]++;
+    m_taskFirst[k] = first[t];
+    m_taskLast[k] = last[t];
+  }
+
+  //Within a task the forward solve scatters each panel into the supernodes
+  //above it, as only the thread of the task writes them. A supernode of a
+  //later task instead gathers from the panels of earlier tasks, so that
+  //tasks of one level never write the same entry. The rows of a panel
+  //owned by one supernode above are consecutive, and are taken as one block
+  Aligned_Array<unsigned int> task_end(m_supernodes);
+  for(unsigned int k = 0; k < m_levelStart[m_levels]; k++)
+  {
+    for(unsigned int s = m_taskFirst[k]; s < m_taskLast[k]; s++)
+      task_end[s] = m_taskLast[k];
+  }
+  m_updateStart = Aligned_Array<unsigned int>(m_supernodes+1);
+  for(unsigned int pass = 0; pass < 2; pass++)
+  {
+    for(unsigned int d = 0; d < m_supernodes; d++)
+    {
+      unsigned int width = m_superStart[d+1]-m_superStart[d];
+      unsigned int height = m_rowStart[d+1]-m_rowStart[d];
+      const unsigned int* rows = m_rows.data()+m_rowStart[d];
+      for(unsigned int begin = width, end = width; begin < height; begin = end)
+      {
+        unsigned int target = m_columnSuper[rows[begin]];
+        while(end < height && m_columnSuper[rows[end]] == target)
+          end++;
+        if(target < task_end[d])
+          continue;
+        if(pass == 0)
+        {
+          m_updateStart[target+1]++;
+          continue;
+        }
+        unsigned int p = fill[target]++;
+        m_updateSuper[p] = d;
+        m_updateFirst[p] = begin;
+        m_updateLast[p] = end;
+      }
+    }
+    if(pass == 0)
+    {
+      for(unsigned int s = 0; s < m_supernodes; s++)
+        m_updateStart[s+1] += m_updateStart[s];
+      m_updateSuper = Aligned_Array<unsigned int>(m_updateStart[m_supernodes]);
+      m_updateFirst = Aligned_Array<unsigned int>(m_updateStart[m_supernodes]);
+      m_updateLast = Aligned_Array<unsigned int>(m_updateStart[m_supernodes]);
+      fill = Aligned_Array<unsigned int>(m_supernodes);
+      for(unsigned int s = 0; s < m_supernodes; s++)
+        fill[s] = m_updateStart[s];
+    }
+  }
+}
+
+template <typename T>
+void Sparse_Cholesky<T>::analyze(const Sparse_Matrix<T>& m)
+{
+  analyze(m, Nested_Dissection<T>()(m));
+}
+
+template <typename T>
+bool Sparse_Cholesky<T>::same_pattern(const Sparse_Matrix<T>& m) const
+{
+  if(!m_analyzed || m.num_rows() != m_n || m.num_cols() != m_n || m.nonzeros() != m_patternColumns.size())
+    return false;
+  const unsigned int* start = m.row_start();
+  const unsigned int* columns = m.col_index();
+  for(unsigned int i = 0; i <= m_n; i++)
+  {
+    if(start[i] != m_patternStart[i])
+      return false;
+  }
+  for(unsigned int k = 0; k < m.nonzeros(); k++)
+  {
+    if(columns[k] != m_patternColumns[k])
+      return false;
+  }
+  return true;
+}
+
+template <typename T>
+void Sparse_Cholesky<T>::assemble(const Sparse_Matrix<T>& m, unsigned int* map)
+{
+  const unsigned int* start = m.row_start();
+  const unsigned int* columns = m.col_index();
+  const T* values = m.values();
+  for(unsigned int k = 0; k < m_values.size(); k++)
+    m_values[k] = 0;
+
+  //Column j of the reordered matrix on and below the diagonal is row j on
+  //and after the diagonal, since the matrix is symmetric
+  for(unsigned int s = 0; s < m_supernodes; s++)
+  {
+    unsigned int first = m_superStart[s];
+    unsigned int width = m_superStart[s+1]-first;
+    T* panel = m_values.data()+m_valueStart[s];
+    for(unsigned int k = m_rowStart[s]; k < m_rowStart[s+1]; k++)
+      map[m_rows[k]] = k-m_rowStart[s];
+    for(unsigned int j = first; j < first+width; j++)
+    {
+      unsigned int old = m_order[j];
+      for(unsigned int k = start[old]; k < start[old+1]; k++)
+      {
+        unsigned int i = m_order.inverse(columns[k]);
+        if(i >= j)
+          panel[map[i]*width + j-first] = values[k];
+      }
+    }
+  }
+}
+
+template <typename T>
+void Sparse_Cholesky<T>::factor_supernode(unsigned int s)
+{
+  unsigned int width = m_superStart[s+1]-m_superStart[s];
+  unsigned int height = m_rowStart[s+1]-m_rowStart[s];
+  T* panel = m_values.data()+m_valueStart[s];
+  //The diagonal block is factored, then the rows below it are solved with it
+  Tile_Kernels<T>::potrf(width, panel, width);
+  Tile_Kernels<T>::trsm(height-width, width, panel, width, panel + width*width, width);
+}
+
+template <typename T>
+void Sparse_Cholesky<T>::update_ancestors(unsigned int s, unsigned int* map, T* scratch)
+{
+  unsigned int width = m_superStart[s+1]-m_superStart[s];
+  const unsigned int* rows = m_rows.data()+m_rowStart[s];
+  unsigned int height = m_rowStart[s+1]-m_rowStart[s];
+  const T* panel = m_values.data()+m_valueStart[s];
+  unsigned int below = height-width;
+  if(below == 0)
+    return;
+
+  //Column rows[k] of L loses the dot product of rows i and k of the panel
+  //for every i >= k below the supernode. All of them are formed at once as
+  //a dense update, the lower triangle of -(B)(B^T) for the rows B below the
+  //supernode
+  for(unsigned int q = 0; q < below*below; q++)
+    scratch[q] = 0;
+  Tile_Kernels<T>::syrk(below, width, panel + width*width, width, scratch, below);
+
+  //The update is then added into the targets. Its columns come in runs
+  //owned by the same supernode, so each row map is only built once per run
+  unsigned int next = width;
+  while(next < height)
+  {
+    unsigned int target = m_columnSuper[rows[next]];
+    unsigned int run = next;
+    while(next < height && m_columnSuper[rows[next]] == target)
+      next++;
+    T* target_panel = m_values.data()+m_valueStart[target];
+    unsigned int target_first = m_superStart[target];
+    unsigned int target_width = m_superStart[target+1]-target_first;
+    for(unsigned int q = m_rowStart[target]; q < m_rowStart[target+1]; q++)
+      map[m_rows[q]] = q-m_rowStart[target];
+    //The columns of a run need not be adjacent in the target
+    for(unsigned int i = run; i < height; i++)
+    {
+      T* out = target_panel + map[rows[i]]*target_width - target_first;
+      const T* update = scratch + (i-width)*below - width;
+      unsigned int last = std::min(i+1, next);
+      for(unsigned int k = run; k < last; k++)
+        out[rows[k]] += update[k];
+    }
+  }
+}
+
+template <typename T>
+void Sparse_Cholesky<T>::factor(const Sparse_Matrix<T>& m)
+{
+  if(!same_pattern(m))
+    analyze(m);
+  m_factored = false;
+  Aligned_Array<unsigned int> map(m_n);
+  assemble(m, map.data());
+  //The update of a supernode is square, one row and column for each row of
+  //its panel below its columns
+  unsigned int most = 0;
+  for(unsigned int s = 0; s < m_supernodes; s++)
+    most = std::max(most, m_rowStart[s+1]-m_rowStart[s]-(m_superStart[s+1]-m_superStart[s]));
+  Aligned_Array<T> scratch(most*most, false);
+  //Right looking, each supernode is final once the ones before it have
+  //sent their updates
+  for(unsigned int s = 0; s < m_supernodes; s++)
+  {
+    factor_supernode(s);
+    update_ancestors(s, map.data(), scratch.data());
+  }
+  m_factored = true;
+}
+
+template <typename T>
+void Sparse_Cholesky<T>::forward_supernode(unsigned int s, unsigned int end, T* y) const
+{
+  unsigned int first = m_superStart[s];
+  unsigned int width = m_superStart[s+1]-first;
+  unsigned int height = m_rowStart[s+1]-m_rowStart[s];
+  const unsigned int* rows = m_rows.data()+m_rowStart[s];
+  const T* panel = m_values.data()+m_valueStart[s];
+  //The columns first take the updates of the panels of earlier tasks,
+  //whose entries of y are final
+  for(unsigned int p = m_updateStart[s]; p < m_updateStart[s+1]; p++)
+  {
+    unsigned int below = m_updateSuper[p];
+    unsigned int below_first = m_superStart[below];
+    unsigned int below_width = m_superStart[below+1]-below_first;
+    const unsigned int* below_rows = m_rows.data()+m_rowStart[below];
+    const T* below_panel = m_values.data()+m_valueStart[below];
+    for(unsigned int i = m_updateFirst[p]; i < m_updateLast[p]; i++)
+      y[below_rows[i]] -= static_cast<T>(Vector_Kernels<T>::dot(below_panel + i*below_width, y+below_first, below_width));
+  }
+  for(unsigned int c = 0; c < width; c++)
+  {
+    const T* row = panel + c*width;
+    y[first+c] = static_cast<T>((y[first+c] - Vector_Kernels<T>::dot(row, y+first, c)) / row[c]);
+  }
+  //Rows are in increasing order, so those owned by the task come first
+  unsigned int bound = m_superStart[end];
+  for(unsigned int i = width; i < height && rows[i] < bound; i++)
+    y[rows[i]] -= static_cast<T>(Vector_Kernels<T>::dot(panel + i*width, y+first, width));
+}
+
+template <typename T>
+void Sparse_Cholesky<T>::backward_supernode(unsigned int s, T* y) const
+{
+  //A row of the panel is a column of L^T, and the rows below the diagonal
+  //block only read entries of y owned by the supernodes above
+  unsigned int first = m_superStart[s];
+  unsigned int width = m_superStart[s+1]-first;
+  unsigned int height = m_rowStart[s+1]-m_rowStart[s];
+  const unsigned int* rows = m_rows.data()+m_rowStart[s];
+  const T* panel = m_values.data()+m_valueStart[s];
+  for(unsigned int i = width; i < height; i++)
+    Vector_Kernels<T>::axpy(-y[rows[i]], panel + i*width, y+first, width);
+  for(unsigned int c = width; c > 0; c--)
+  {
+    const T* row = panel + (c-1)*width;
+    y[first+c-1] /= row[c-1];
+    Vector_Kernels<T>::axpy(-y[first+c-1], row, y+first, c-1);
+  }
+}
+
+template <typename T>
+Vector<T> Sparse_Cholesky<T>::solve(const Vector<T>& b) const
+{
+  if(!m_factored)
+    throw SingularError();
+  if(b.size() != m_n)
+    throw DimensionError(b.size());
+  Vector<T> x(m_order.apply(b));
+  T* y = x.data();
+  Thread_Pool& pool = Thread_Pool::shared();
+
+  //Forward sweep from the leaves up, backward sweep from the roots down,
+  //each a level at a time
+  for(unsigned int l = 0; l < m_levels; l++)
+  {
+    pool.parallel_for(m_levelStart[l], m_levelStart[l+1], m_levelGrain[l], [this, y](unsigned int first, unsigned int last)
+    {
+      for(unsigned int k = first; k < last; k++)
+      {
+        for(unsigned int s = m_taskFirst[k]; s < m_taskLast[k]; s++)
+          forward_supernode(s, m_taskLast[k], y);
+      }
+    });
+  }
+  for(unsigned int l = m_levels; l > 0; l--)
+  {
+    pool.parallel_for(m_levelStart[l-1], m_levelStart[l], m_levelGrain[l-1], [this, y](unsigned int first, unsigned int last)
+    {
+      for(unsigned int k = first; k < last; k++)
+      {
+        for(unsigned int s = m_taskLast[k]; s > m_taskFirst[k]; s--)
+          backward_supernode(s-1, y);
+      }
+    });
+  }
+  return m_order.unapply(x);
+}
+
+template <typename T>
+Vector<T> Sparse_Cholesky<T>::operator()(const Sparse_Matrix<T>& m, const Vector<T>& b) const
+{
+  if(m.num_rows() != b.size())
+    throw DimensionError(b.size());
+  Sparse_Cholesky<T> cholesky;
+  cholesky.factor(m);
+  return cholesky.solve(b);
+}
+
+template <typename T>
+unsigned int Sparse_Cholesky<T>::size() const
+{
+  return m_n;
+}
+
+template <typename T>
+unsigned int Sparse_Cholesky<T>::supernodes() const
+{
+  return m_supernodes;
+}
+
+template <typename T>
+unsigned int Sparse_Cholesky<T>::levels() const
+{
+  return m_levels;
+}
+
+template <typename T>
+unsigned int Sparse_Cholesky<T>::nonzeros() const
+{
+  //The upper triangle of each diagonal block is stored but not part of L
+  unsigned int count = 0;
+  for(unsigned int s = 0; s < m_supernodes; s++)
+  {
+    unsigned int width = m_superStart[s+1]-m_superStart[s];
+    count += (m_valueStart[s+1]-m_valueStart[s]) - width*(width-1)/2;
+  }
+  return count;
+}
+
+template <typename T>
+const Permutation& Sparse_Cholesky<T>::order() const
+{
+  return m_order;
+}
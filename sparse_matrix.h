@@ -0,0 +1,276 @@
+#ifndef SPARSE_MATRIX_H
+#define SPARSE_MATRIX_H
+
+/**
+ *  @file sparse_matrix.h
+ *  @brief Class defintion for sparse matrix
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <iostream>
+#include <utility>
+#include "Aligned_Array.h"
+#include "abstract_matrix.h"
+#include "matrix.h"
+#include "symmetric_matrix.h"
+#include "symmetric_banded_matrix.h"
+#include "InputError.h"
+
+///
+/// \class Sparse_Matrix
+/// \brief This class is a matrix in compressed sparse row form. Only the
+///        stored elements are kept: the elements of row i are at positions
+///        row_start()[i] to row_start()[i+1]-1 of values(), with their
+///        columns at the same positions of col_index(), in increasing
+///        order. Every other element is zero. Memory and the cost of a
+///        matrix vector product grow with the number of stored elements
+///
+
+template <typename T>
+class Sparse_Matrix : public Abstract_Matrix<T>
+{
+private:
+  unsigned int m_rows; //!< number of rows
+  unsigned int m_cols; //!< number of columns
+  Aligned_Array<unsigned int> m_start; //!< position of the first stored element of each row, with one more for the end
+  Aligned_Array<unsigned int> m_columns; //!< column of each stored element
+  Aligned_Array<T> m_values; //!< value of each stored element
+  //! Finds a stored element
+  /// \pre row < m_rows and col < m_cols
+  /// \post Returns the position of element (row, col), or m_start[m_rows] if it is not stored
+  unsigned int find(unsigned int row, unsigned int col) const;
+  //! Triplet builder
+  /// \pre rows, cols and values point to count triplets. parts > 0
+  /// \post The triplets are sorted into rows and merged. Each phase is split into parts parts run on the shared pool, and the result does not depend on parts. Throws error if an index is out of range
+  void build(unsigned int parts, const unsigned int* rows, const unsigned int* cols, const T* values, unsigned int count);
+public:
+  //! Default Constructor
+  /// \pre None
+  /// \post Sparse_Matrix of 0 x 0 is constructed
+  Sparse_Matrix():m_rows(0),m_cols(0),m_start(1){}
+  //! Constructor with integer parameters
+  /// \pre None
+  /// \post Sparse_Matrix of rows x cols with no stored elements is constructed
+  /// @param rows of type unsigned int
+  /// @param cols of type unsigned int
+  Sparse_Matrix(unsigned int rows, unsigned int cols);
+  //! Constructor from triplets
+  /// \pre rows, cols and values have the same size. Operator+ (T+T) must be defined
+  /// \post Element (rows[k], cols[k]) holds values[k]. Values given for the same element are added, in the order given. The work is split into threads parts on the shared pool, 0 for one per pool thread, and the result does not depend on it. Throws error if the sizes differ or an index is out of range
+  /// @param numRows of type unsigned int
+  /// @param numCols of type unsigned int
+  /// @param rows of type const Aligned_Array<unsigned int>&
+  /// @param cols of type const Aligned_Array<unsigned int>&
+  /// @param values of type const Aligned_Array<T>&
+  /// @param threads of type unsigned int
+  Sparse_Matrix(unsigned int numRows, unsigned int numCols, const Aligned_Array<unsigned int>& rows,
+                const Aligned_Array<unsigned int>& cols, const Aligned_Array<T>& values, unsigned int threads = 0);
+  //! Move Constructor
+  /// \pre None
+  /// \post Object constructed by moving rvalue
+  /// @param m of type Sparse_Matrix<T>&&
+  Sparse_Matrix(Sparse_Matrix<T>&& m);
+  //! Copy Constructor
+  /// \pre None
+  /// \post New copy of m is created
+  /// @param m of type const Sparse_Matrix<T>&
+  Sparse_Matrix(const Sparse_Matrix<T>& m);
+  //! Copy Constructor for any other type of matrix
+  /// \pre Comparison to 0 must be defined for T
+  /// \post New copy of m is created, storing only its non-zero elements
+  /// @param m of type const Abstract_Matrix<T>&
+  Sparse_Matrix(const Abstract_Matrix<T>& m);
+  //! Copy Constructor for banded matrices
+  /// \pre Comparison to 0 must be defined for T
+  /// \post New copy of m is created, storing only the non-zero elements of its band
+  /// @param m of type const Symmetric_Banded_Matrix<T>&
+  Sparse_Matrix(const Symmetric_Banded_Matrix<T>& m);
+  //! Builds a matrix from compressed rows
+  /// \pre start has numRows+1 elements, and columns and values hold the elements of each row in increasing column order
+  /// \post Returns the matrix holding the given rows. Throws error if the rows are not valid
+  /// @param numRows of type unsigned int
+  /// @param numCols of type unsigned int
+  /// @param start of type const Aligned_Array<unsigned int>&
+  /// @param columns of type const Aligned_Array<unsigned int>&
+  /// @param values of type const Aligned_Array<T>&
+  static Sparse_Matrix<T> from_compressed_rows(unsigned int numRows, unsigned int numCols, const Aligned_Array<unsigned int>& start,
+                                               const Aligned_Array<unsigned int>& columns, const Aligned_Array<T>& values);
+  //! Conversion to a dense matrix
+  /// \pre None
+  /// \post Returns the matrix with every element stored
+  Matrix<T> to_matrix() const;
+  //! Conversion to a symmetric matrix
+  /// \pre The matrix is square and symmetric
+  /// \post Returns the matrix in packed symmetric form. Throws error if the matrix is not square or not symmetric
+  Symmetric_Matrix<T> to_symmetric() const;
+  //! Addition operator for any other type of matrix
+  /// \pre calling object and m must be of equal dimension. Operator+ for (T+T) must be defined
+  /// \post returns the sum of the matrcies. Throws error if m and the calling object are of not equal dimension
+  /// @param m of type const Abstract_Matrix<T>&
+  virtual Matrix<T> operator+(const Abstract_Matrix<T>& m) const;
+  //! Substraction operator for and other type of matrix
+  /// \pre calling object and m must be of equal dimension. Operator- for (T-T) must be defined
+  /// \post returns the difference of the matricies. throws error if m and the calling object do not have the same dimension
+  /// @param m of type const Abstract_Matrix<T>&
+  virtual Matrix<T> operator-(const Abstract_Matrix<T>& m) const;
+  //! Matrix multiplcaiton operator for any matrix
+  /// \pre num_cols() for the calling object is equal to the number of rows in m
+  /// \post Returns the product of the matrcies, reading only the stored elements of the calling object. Throws error if the number fo columns in the calling object are not equal to the rows in m
+  /// @param m of type Abstract_Matrix<T>&
+  virtual Matrix<T> operator*(const Abstract_Matrix<T>& m) const;
+  //! Transpose of the matrix
+  /// \pre None
+  /// \post Returns the transpose of the matrix, in time proportional to the stored elements
+  Sparse_Matrix<T> transpose() const;
+  //! Vector multiplcaiton operator
+  /// \pre size of v must be the same as the number of columns in the matrix
+  /// \post returns the vector b of Ax = b, only touching the stored elements. Throws error if the size of v is not the same as the number of columns in the matrix
+  /// @param v of type const Vector<T>&
+  virtual Vector<T> operator*(const Vector<T>& v) const;
+  //! Assignment operator
+  /// \pre None
+  /// \post Calling Object is now equal to m
+  /// @param m of type Sparse_Matrix<T>
+  Sparse_Matrix<T>& operator=(Sparse_Matrix<T> m);
+  //! Get a column vector
+  /// \pre 0 <= index < num_cols()
+  /// \post returns the column vector at the index. Throws error if the inequality in the precondition is not satisfied
+  /// @param index of type unsigned int
+  virtual Vector<T> col_vector(unsigned int index) const;
+  //! Return the number of rows in the matrix
+  /// \pre None
+  /// \post Returns the number of rows in the matrix
+  virtual unsigned int num_rows() const;
+  //! Return the number of columns in the matrix
+  /// \pre None
+  /// \post Returns the number of columns in the matrix
+  virtual unsigned int num_cols() const;
+  //! Return the number of stored elements
+  /// \pre None
+  /// \post Returns the number of stored elements
+  unsigned int nonzeros() const;
+  //! Raw pointer to the row starts
+  /// \pre None
+  /// \post Returns a pointer to the num_rows()+1 row starts
+  const unsigned int* row_start() const;
+  //! Raw pointer to the columns
+  /// \pre None
+  /// \post Returns a pointer to the column of each stored element
+  const unsigned int* col_index() const;
+  //! Raw pointer to the values
+  /// \pre None
+  /// \post Returns a pointer to the value of each stored element
+  T* values();
+  //! Raw pointer to the values (calling object not mutable in this version)
+  /// \pre None
+  /// \post Returns a pointer to the value of each stored element
+  const T* values() const;
+  //! Indexing operator
+  /// \pre 0 <= row < num_rows() and 0 <= col < num_cols()
+  /// \post Return the the specified index, zero if it is not stored. Throws error if either inequalities in the pre condtiion are not satisfied
+  /// @param row of type unsigned int
+  /// @param col of type unsigned int
+  virtual T operator()(unsigned int row, unsigned int col) const;
+  //! Returns a reference to an element
+  /// \pre 0 <= row < num_rows and 0 <= col < num_cols, and element (row, col) is stored
+  /// \post returns a reference to the specified element. Throws error if either of the inequalities are not satisfied and throws and error if the element is not stored
+  /// @param row of type unsigned int
+  /// @param col of type unsigned int
+  virtual T& get_elem(unsigned int row, unsigned int col);
+
+  //! Swap operation
+  /// \pre None
+  /// \post Swaps the contents of m1 and m2
+  /// @param m1 of type Sparse_Matrix<T>&
+  /// @param m2 of type Sparse_Matrix<T>&
+  friend void swap(Sparse_Matrix<T>& m1, Sparse_Matrix<T>& m2)
+  {
+    std::swap(m1.m_rows, m2.m_rows);
+    std::swap(m1.m_cols, m2.m_cols);
+    swap(m1.m_start, m2.m_start);
+    swap(m1.m_columns, m2.m_columns);
+    swap(m1.m_values, m2.m_values);
+  }
+
+  //! Output operator
+  /// \pre operator<< must be defined for T
+  /// \post outputs every element of the matrix row by row
+  /// @param os of type ostream&
+  /// @param m of type const Sparse_Matrix<T>&
+  friend std::ostream& operator<<(std::ostream& os, const Sparse_Matrix<T>& m)
+  {
+    for(unsigned int i = 0; i < m.m_rows; i++)
+    {
+      unsigned int k = m.m_start[i];
+      for(unsigned int j = 0; j < m.m_cols; j++)
+      {
+        if(k < m.m_start[i+1] && m.m_columns[k] == j)
+          os << m.m_values[k++] << " ";
+        else
+          os << T(0) << " ";
+      }
+      os << std::endl;
+    }
+    return os;
+  }
+
+  //! insertion operator
+  /// \pre Input must be valid, every element of the matrix row by row. Comparison to 0 must be defined for T
+  /// \post The matrix holds the non-zero elements read. Throws error if Input is invalid
+  /// @param in of type istream&
+  /// @param m of type Sparse_Matrix<T>&
+  friend std::istream& operator>>(std::istream& in, Sparse_Matrix<T>& m)
+  {
+    //The pattern is not known until the row is read, so rows go through a buffer
+    Aligned_Array<T> row(m.m_cols);
+    Aligned_Array<unsigned int> start(m.m_rows+1);
+    Aligned_Array<unsigned int> columns(m.m_rows+m.m_cols);
+    Aligned_Array<T> values(m.m_rows+m.m_cols);
+    unsigned int count = 0;
+    for(unsigned int i = 0; i < m.m_rows; i++)
+    {
+      for(unsigned int j = 0; j < m.m_cols; j++)
+      {
+        if(!in || in.eof())
+          throw InputError();
+        in >> row[j];
+      }
+      for(unsigned int j = 0; j < m.m_cols; j++)
+      {
+        if(row[j] != 0)
+        {
+          if(count == columns.size())
+          {
+            //Double the room, copying what was read so far
+            Aligned_Array<unsigned int> wider_columns(2*count);
+            Aligned_Array<T> wider_values(2*count);
+            for(unsigned int k = 0; k < count; k++)
+            {
+              wider_columns[k] = columns[k];
+              wider_values[k] = values[k];
+            }
+            swap(columns, wider_columns);
+            swap(values, wider_values);
+          }
+          columns[count] = j;
+          values[count++] = row[j];
+        }
+      }
+      start[i+1] = count;
+    }
+    m.m_start = start;
+    m.m_columns = Aligned_Array<unsigned int>(count);
+    m.m_values = Aligned_Array<T>(count);
+    for(unsigned int k = 0; k < count; k++)
+    {
+      m.m_columns[k] = columns[k];
+      m.m_values[k] = values[k];
+    }
+    return in;
+  }
+};
+
+#include "sparse_matrix.hpp"
+
+#endif
@@ -0,0 +1,555 @@
+/**
+ *  @file sparse_matrix.hpp
+ *  @brief Class implmentation for sparse matrix
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <algorithm>
+#include <functional>
+#include "Array.h"
+#include "RangeError.h"
+#include "DimensionError.h"
+#include "MatrixDimError.h"
+#include "ModificationError.h"
+#include "thread_pool.h"
+
+template <typename T>
+Sparse_Matrix<T>::Sparse_Matrix(unsigned int rows, unsigned int cols)
+  :m_rows(rows),m_cols(cols),m_start(rows+1)
+{
+}
+
+template <typename T>
+void Sparse_Matrix<T>::build(unsigned int parts, const unsigned int* rows, const unsigned int* cols, const T* values, unsigned int count)
+{
+  Thread_Pool& pool = Thread_Pool::shared();
+  //The triplets and the rows are each split as evenly as possible, the
+  //first few parts get one more. Each phase runs the parts on the pool
+  auto split = [parts](unsigned int total, unsigned int part, unsigned int& first, unsigned int& last)
+  {
+    unsigned int share = total / parts;
+    unsigned int extra = total % parts;
+    first = part*share + (part < extra ? part : extra);
+    last = first + share + (part < extra ? 1 : 0);
+  };
+  auto phase = [&pool, parts](const std::function<void(unsigned int)>& work)
+  {
+    pool.parallel_for(0, parts, 1, [&work](unsigned int first, unsigned int last)
+    {
+      for(unsigned int part = first; part < last; part++)
+        work(part);
+    });
+  };
+  Aligned_Array<unsigned int> counts(parts*m_rows);
+  Aligned_Array<unsigned int> bad(parts);
+  Aligned_Array<unsigned int> columns(count);
+  Aligned_Array<T> merged(count);
+  unsigned int* start = m_start.data();
+
+  //Count the triplets of each row in each part
+  phase([&](unsigned int part)
+  {
+    unsigned int first, last;
+    split(count, part, first, last);
+    unsigned int* position = counts.data() + part*m_rows;
+    bad[part] = count;
+    for(unsigned int k = first; k < last; k++)
+    {
+      if(rows[k] >= m_rows || cols[k] >= m_cols)
+      {
+        bad[part] = k;
+        break;
+      }
+      position[rows[k]]++;
+    }
+  });
+  for(unsigned int part = 0; part < parts; part++)
+  {
+    if(bad[part] != count)
+      throw RangeError(rows[bad[part]] >= m_rows ? rows[bad[part]] : cols[bad[part]]);
+  }
+
+  //Row totals, added up into row starts
+  phase([&](unsigned int part)
+  {
+    unsigned int first_row, last_row;
+    split(m_rows, part, first_row, last_row);
+    for(unsigned int r = first_row; r < last_row; r++)
+    {
+      unsigned int total = 0;
+      for(unsigned int t = 0; t < parts; t++)
+        total += counts[t*m_rows+r];
+      start[r+1] = total;
+    }
+  });
+  for(unsigned int r = 0; r < m_rows; r++)
+    start[r+1] += start[r];
+
+  //Inside a row the triplets of the parts go in part order, so the
+  //triplets of a row stay in the order given
+  phase([&](unsigned int part)
+  {
+    unsigned int first_row, last_row;
+    split(m_rows, part, first_row, last_row);
+    for(unsigned int r = first_row; r < last_row; r++)
+    {
+      unsigned int next = start[r];
+      for(unsigned int t = 0; t < parts; t++)
+      {
+        unsigned int c = counts[t*m_rows+r];
+        counts[t*m_rows+r] = next;
+        next += c;
+      }
+    }
+  });
+  phase([&](unsigned int part)
+  {
+    unsigned int first, last;
+    split(count, part, first, last);
+    unsigned int* position = counts.data() + part*m_rows;
+    for(unsigned int k = first; k < last; k++)
+    {
+      unsigned int p = position[rows[k]]++;
+      columns[p] = cols[k];
+      merged[p] = values[k];
+    }
+  });
+
+  //Sort each row by column and add up repeated elements. The sort is
+  //stable so repeats are added in the order given. The merged length of
+  //each row is left in the counts of the first part
+  phase([&](unsigned int part)
+  {
+    unsigned int first_row, last_row;
+    split(m_rows, part, first_row, last_row);
+    unsigned int longest = 0;
+    for(unsigned int r = first_row; r < last_row; r++)
+      longest = std::max(longest, start[r+1]-start[r]);
+    Aligned_Array<std::pair<unsigned int, T>> row(longest);
+    for(unsigned int r = first_row; r < last_row; r++)
+    {
+      unsigned int length = start[r+1]-start[r];
+      for(unsigned int k = 0; k < length; k++)
+        row[k] = std::make_pair(columns[start[r]+k], merged[start[r]+k]);
+      std::stable_sort(row.data(), row.data()+length,
+                       [](const std::pair<unsigned int, T>& a, const std::pair<unsigned int, T>& b){ return a.first < b.first; });
+      unsigned int kept = 0;
+      for(unsigned int k = 0; k < length; k++)
+      {
+        if(kept > 0 && columns[start[r]+kept-1] == row[k].first)
+          merged[start[r]+kept-1] += row[k].second;
+        else
+        {
+          columns[start[r]+kept] = row[k].first;
+          merged[start[r]+kept] = row[k].second;
+          kept++;
+        }
+      }
+      counts[r] = kept;
+    }
+  });
+
+  //Squeeze out the room left by the repeats
+  Aligned_Array<unsigned int> final_start(m_rows+1);
+  for(unsigned int r = 0; r < m_rows; r++)
+    final_start[r+1] = final_start[r] + counts[r];
+  m_columns = Aligned_Array<unsigned int>(final_start[m_rows]);
+  m_values = Aligned_Array<T>(final_start[m_rows]);
+  //The old starts are still needed to find the merged rows
+  for(unsigned int r = 0; r < m_rows; r++)
+    counts[r] = start[r];
+  swap(m_start, final_start);
+  start = m_start.data();
+  phase([&](unsigned int part)
+  {
+    unsigned int first_row, last_row;
+    split(m_rows, part, first_row, last_row);
+    for(unsigned int r = first_row; r < last_row; r++)
+    {
+      for(unsigned int k = 0; k < start[r+1]-start[r]; k++)
+      {
+        m_columns[start[r]+k] = columns[counts[r]+k];
+        m_values[start[r]+k] = merged[counts[r]+k];
+      }
+    }
+  });
+}
+
+template <typename T>
+Sparse_Matrix<T>::Sparse_Matrix(unsigned int numRows, unsigned int numCols, const Aligned_Array<unsigned int>& rows,
+                                const Aligned_Array<unsigned int>& cols, const Aligned_Array<T>& values, unsigned int threads)
+  :m_rows(numRows),m_cols(numCols),m_start(numRows+1)
+{
+  if(cols.size() != rows.size())
+    throw DimensionError(cols.size());
+  if(values.size() != rows.size())
+    throw DimensionError(values.size());
+  unsigned int count = rows.size();
+
+  //Small inputs are not worth splitting
+  if(threads == 0)
+    threads = std::min(Thread_Pool::shared().size(), count/4096+1);
+  if(threads > count)
+    threads = count;
+  if(threads == 0)
+    threads = 1;
+  build(threads, rows.data(), cols.data(), values.data(), count);
+}
+
+template <typename T>
+Sparse_Matrix<T> Sparse_Matrix<T>::from_compressed_rows(unsigned int numRows, unsigned int numCols, const Aligned_Array<unsigned int>& start,
+                                                        const Aligned_Array<unsigned int>& columns, const Aligned_Array<T>& values)
+{
+  if(start.size() != numRows+1)
+    throw DimensionError(start.size());
+  if(values.size() != columns.size())
+    throw DimensionError(values.size());
+  if(start[0] != 0 || start[numRows] != columns.size())
+    throw InputError();
+  for(unsigned int i = 0; i < numRows; i++)
+  {
+    if(start[i+1] < start[i])
+      throw InputError();
+    for(unsigned int k = start[i]; k < start[i+1]; k++)
+    {
+      if(columns[k] >= numCols || (k > start[i] && columns[k] <= columns[k-1]))
+        throw InputError();
+    }
+  }
+  Sparse_Matrix<T> result;
+  result.m_rows = numRows;
+  result.m_cols = numCols;
+  result.m_start = start;
+  result.m_columns = columns;
+  result.m_values = values;
+  return result;
+}
+
+template <typename T>
+Sparse_Matrix<T>::Sparse_Matrix(Sparse_Matrix<T>&& m)
+{
+  m_rows = std::move(m.m_rows);
+  m_cols = std::move(m.m_cols);
+  m_start = std::move(m.m_start);
+  m_columns = std::move(m.m_columns);
+  m_values = std::move(m.m_values);
+}
+
+template <typename T>
+Sparse_Matrix<T>::Sparse_Matrix(const Sparse_Matrix<T>& m)
+{
+  m_rows = m.m_rows;
+  m_cols = m.m_cols;
+  m_start = m.m_start;
+  m_columns = m.m_columns;
+  m_values = m.m_values;
+}
+
+template <typename T>
+Sparse_Matrix<T>::Sparse_Matrix(const Abstract_Matrix<T>& m)
+  :m_rows(m.num_rows()),m_cols(m.num_cols()),m_start(m.num_rows()+1)
+{
+  //Count the non-zero elements of each row, then store them
+  for(unsigned int i = 0; i < m_rows; i++)
+  {
+    m_start[i+1] = m_start[i];
+    for(unsigned int j = 0; j < m_cols; j++)
+    {
+      if(m(i, j) != 0)
+        m_start[i+1]++;
+    }
+  }
+  m_columns = Aligned_Array<unsigned int>(m_start[m_rows]);
+  m_values = Aligned_Array<T>(m_start[m_rows]);
+  unsigned int k = 0;
+  for(unsigned int i = 0; i < m_rows; i++)
+  {
+    for(unsigned int j = 0; j < m_cols; j++)
+    {
+      T value = m(i, j);
+      if(value != 0)
+      {
+        m_columns[k] = j;
+        m_values[k++] = value;
+      }
+    }
+  }
+}
+
+template <typename T>
+Sparse_Matrix<T>::Sparse_Matrix(const Symmetric_Banded_Matrix<T>& m)
+  :m_rows(m.num_rows()),m_cols(m.num_cols()),m_start(m.num_rows()+1)
+{
+  unsigned int band = m.bandwidth();
+  for(unsigned int i = 0; i < m_rows; i++)
+  {
+    m_start[i+1] = m_start[i];
+    unsigned int last = std::min(m_cols-1, i+band);
+    for(unsigned int j = (i > band ? i-band : 0); j <= last; j++)
+    {
+      if(m(i, j) != 0)
+        m_start[i+1]++;
+    }
+  }
+  m_columns = Aligned_Array<unsigned int>(m_start[m_rows]);
+  m_values = Aligned_Array<T>(m_start[m_rows]);
+  unsigned int k = 0;
+  for(unsigned int i = 0; i < m_rows; i++)
+  {
+    unsigned int last = std::min(m_cols-1, i+band);
+    for(unsigned int j = (i > band ? i-band : 0); j <= last; j++)
+    {
+      T value = m(i, j);
+      if(value != 0)
+      {
+        m_columns[k] = j;
+        m_values[k++] = value;
+      }
+    }
+  }
+}
+
+template <typename T>
+unsigned int Sparse_Matrix<T>::find(unsigned int row, unsigned int col) const
+{
+  const unsigned int* first = m_columns.data()+m_start[row];
+  const unsigned int* last = m_columns.data()+m_start[row+1];
+  const unsigned int* found = std::lower_bound(first, last, col);
+  if(found == last || *found != col)
+    return m_start[m_rows];
+  return static_cast<unsigned int>(found-m_columns.data());
+}
+
+template <typename T>
+Matrix<T> Sparse_Matrix<T>::to_matrix() const
+{
+  Matrix<T> result(m_rows, m_cols);
+  for(unsigned int i = 0; i < m_rows; i++)
+  {
+    T* row = result[i].data();
+    for(unsigned int k = m_start[i]; k < m_start[i+1]; k++)
+      row[m_columns[k]] = m_values[k];
+  }
+  return result;
+}
+
+template <typename T>
+Symmetric_Matrix<T> Sparse_Matrix<T>::to_symmetric() const
+{
+  if(m_rows != m_cols)
+    throw MatrixDimError(m_rows, m_cols);
+  Symmetric_Matrix<T> result(m_rows);
+  for(unsigned int i = 0; i < m_rows; i++)
+  {
+    for(unsigned int k = m_start[i]; k < m_start[i+1]; k++)
+    {
+      if(operator()(m_columns[k], i) != m_values[k])
+        throw ModificationError();
+      if(m_columns[k] <= i)
+        result.get_elem(i, m_columns[k]) = m_values[k];
+    }
+  }
+  return result;
+}
+
+template <typename T>
+Matrix<T> Sparse_Matrix<T>::operator+(const Abstract_Matrix<T>& m) const
+{
+  if(m_rows != m.num_rows() || m_cols != m.num_cols())
+    throw MatrixDimError(m_rows, m_cols);
+  Matrix<T> temp(m_rows, m_cols);
+  for(unsigned int i = 0; i < m_rows; i++)
+  {
+    T* row = temp[i].data();
+    for(unsigned int j = 0; j < m_cols; j++)
+      row[j] = m(i, j);
+    for(unsigned int k = m_start[i]; k < m_start[i+1]; k++)
+      row[m_columns[k]] = m_values[k] + row[m_columns[k]];
+  }
+  return temp;
+}
+
+template <typename T>
+Matrix<T> Sparse_Matrix<T>::operator-(const Abstract_Matrix<T>& m) const
+{
+  if(m_rows != m.num_rows() || m_cols != m.num_cols())
+    throw MatrixDimError(m_rows, m_cols);
+  Matrix<T> temp(m_rows, m_cols);
+  for(unsigned int i = 0; i < m_rows; i++)
+  {
+    T* row = temp[i].data();
+    for(unsigned int j = 0; j < m_cols; j++)
+      row[j] = -m(i, j);
+    for(unsigned int k = m_start[i]; k < m_start[i+1]; k++)
+      row[m_columns[k]] = m_values[k] + row[m_columns[k]];
+  }
+  return temp;
+}
+
+template <typename T>
+Matrix<T> Sparse_Matrix<T>::operator*(const Abstract_Matrix<T>& m) const
+{
+  if(m_cols != m.num_rows())
+    throw MatrixDimError(m.num_rows(), m_cols);
+  Matrix<T> result(m_rows, m.num_cols());
+  for(unsigned int i = 0; i < m_rows; i++)
+  {
+    //Row i of the product is a sum of the rows of m picked by the stored elements
+    T* row = result[i].data();
+    for(unsigned int k = m_start[i]; k < m_start[i+1]; k++)
+    {
+      for(unsigned int j = 0; j < m.num_cols(); j++)
+        row[j] += m_values[k]*m(m_columns[k], j);
+    }
+  }
+  return result;
+}
+
+template <typename T>
+Sparse_Matrix<T> Sparse_Matrix<T>::transpose() const
+{
+  //Counting sort by column. Rows are visited in order, so the columns of
+  //the transpose come out sorted
+  Aligned_Array<unsigned int> start(m_cols+1);
+  for(unsigned int k = 0; k < m_start[m_rows]; k++)
+    start[m_columns[k]+1]++;
+  for(unsigned int j = 0; j < m_cols; j++)
+    start[j+1] += start[j];
+  Aligned_Array<unsigned int> next(start);
+  Aligned_Array<unsigned int> columns(m_start[m_rows]);
+  Aligned_Array<T> values(m_start[m_rows]);
+  for(unsigned int i = 0; i < m_rows; i++)
+  {
+    for(unsigned int k = m_start[i]; k < m_start[i+1]; k++)
+    {
+      unsigned int p = next[m_columns[k]]++;
+      columns[p] = i;
+      values[p] = m_values[k];
+    }
+  }
+  Sparse_Matrix<T> result;
+  result.m_rows = m_cols;
+  result.m_cols = m_rows;
+  swap(result.m_start, start);
+  swap(result.m_columns, columns);
+  swap(result.m_values, values);
+  return result;
+}
+
+template <typename T>
+Vector<T> Sparse_Matrix<T>::operator*(const Vector<T>& v) const
+{
+  if(v.size() != m_cols)
+    throw MatrixDimError(v.size(), m_cols);
+  Vector<T> result(m_rows);
+  const unsigned int* start = m_start.data();
+  const unsigned int* columns = m_columns.data();
+  const T* values = m_values.data();
+  const T* x = v.data();
+  T* y = result.data();
+  //Rows are independent, a band of them is given to each task of the pool
+  unsigned int grain = Thread_Pool::grain(m_values.size()/(m_rows+1));
+  Thread_Pool::shared().parallel_for(0, m_rows, grain, [start, columns, values, x, y](unsigned int first, unsigned int last)
+  {
+    for(unsigned int i = first; i < last; i++)
+    {
+      T sum = 0;
+      for(unsigned int k = start[i]; k < start[i+1]; k++)
+        sum += values[k]*x[columns[k]];
+      y[i] = sum;
+    }
+  });
+  return result;
+}
+
+template <typename T>
+Sparse_Matrix<T>& Sparse_Matrix<T>::operator=(Sparse_Matrix<T> m)
+{
+  swap((*this), m);
+  return *this;
+}
+
+template <typename T>
+Vector<T> Sparse_Matrix<T>::col_vector(unsigned int index) const
+{
+  if(index >= m_cols)
+    throw RangeError(index);
+  Vector<T> temp(m_rows);
+  for(unsigned int i = 0; i < m_rows; i++)
+  {
+    unsigned int k = find(i, index);
+    if(k != m_start[m_rows])
+      temp[i] = m_values[k];
+  }
+  return temp;
+}
+
+template <typename T>
+unsigned int Sparse_Matrix<T>::num_rows() const
+{
+  return m_rows;
+}
+
+template <typename T>
+unsigned int Sparse_Matrix<T>::num_cols() const
+{
+  return m_cols;
+}
+
+template <typename T>
+unsigned int Sparse_Matrix<T>::nonzeros() const
+{
+  return m_start[m_rows];
+}
+
+template <typename T>
+const unsigned int* Sparse_Matrix<T>::row_start() const
+{
+  return m_start.data();
+}
+
+template <typename T>
+const unsigned int* Sparse_Matrix<T>::col_index() const
+{
+  return m_columns.data();
+}
+
+template <typename T>
+T* Sparse_Matrix<T>::values()
+{
+  return m_values.data();
+}
+
+template <typename T>
+const T* Sparse_Matrix<T>::values() const
+{
+  return m_values.data();
+}
+
+template <typename T>
+T Sparse_Matrix<T>::operator()(unsigned int row, unsigned int col) const
+{
+  if(row >= m_rows)
+    throw RangeError(row);
+  if(col >= m_cols)
+    throw RangeError(col);
+  unsigned int k = find(row, col);
+  if(k == m_start[m_rows])
+    return 0;
+  return m_values[k];
+}
+
+template <typename T>
+T& Sparse_Matrix<T>::get_elem(unsigned int row, unsigned int col)
+{
+  if(row >= m_rows)
+    throw RangeError(row);
+  if(col >= m_cols)
+    throw RangeError(col);
+  //Elements that are not stored have no place to be written to
+  unsigned int k = find(row, col);
+  if(k == m_start[m_rows])
+    throw ModificationError();
+  return m_values[k];
+}
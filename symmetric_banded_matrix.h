@@ -0,0 +1,201 @@
+#ifndef SYMM_BANDED_MATRIX_H
+#define SYMM_BANDED_MATRIX_H
+/**
+ *  @file symmetric_banded_matrix.h
+ *  @brief Class defintion for symmetric banded matrix
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include "vector.h"
+#include "abstract_matrix.h"
+#include "Array.h"
+
+//Forward declare class
+template <typename T>
+class Matrix;
+
+///
+/// \class Symmetric_Banded_Matrix
+/// \brief This class acts as a symmetric matrix whose non-zero elements all
+///        lie within bandwidth diagonals of the main diagonal. Only the main
+///        diagonal and the bandwidth sub-diagonals are stored.
+///
+
+template <typename T>
+class Symmetric_Banded_Matrix : public Abstract_Matrix<T>
+{
+private:
+  unsigned int m_n; //!< number of rows and cols for the matrix
+  unsigned int m_bandwidth; //!< number of sub-diagonals stored below the main diagonal
+  unsigned int m_total_elements; //!< total number of elements in the array, n*(bandwidth+1)
+  Array<T> m_elements; //!< Array of elements, stored row by row from column row-bandwidth to row
+public:
+  //! Default Constructor
+  /// \pre None
+  /// \post Creates matrix with no elements
+  Symmetric_Banded_Matrix():m_n(0),m_bandwidth(0),m_total_elements(0){}
+  //! Constructor
+  /// \pre None
+  /// \post Creates a n x n Symmetric banded matrix. A bandwidth larger than n-1 is reduced to n-1
+  /// @param n of type unsigned int
+  /// @param bandwidth of type unsigned int
+  Symmetric_Banded_Matrix(unsigned int n, unsigned int bandwidth);
+  //! Move Constructor
+  /// \pre None
+  /// \post creates matrix by movment rvalue reference
+  /// @param m of type Symmetric_Banded_Matrix<T>&&
+  Symmetric_Banded_Matrix(Symmetric_Banded_Matrix<T>&& m);
+  //! Copy Constructor
+  /// \pre None
+  /// \post Now copy of m is created
+  /// @param m of type const Symmetric_Banded_Matrix<T>&
+  Symmetric_Banded_Matrix(const Symmetric_Banded_Matrix<T>& m);
+  //! Copy Constructor for Abstract Base
+  /// \pre m's element are in Symmetric (But the object is not nessasarly a Symmetric_Banded_Matrix object)
+  /// \post New copy of m is created, with the smallest bandwidth that holds every non-zero element. Throws error if m is not of symmetric
+  /// @param m of type Abstract_Matrix<T>&
+  Symmetric_Banded_Matrix(const Abstract_Matrix<T>& m);
+  //! Addition Operator for Symmetric_Banded_Matrix
+  /// \pre calling object and m must be of equal dimension. Operator+ for (T+T) must be defined
+  /// \post returns the sum of the matricies, with the larger of the two bandwidths. throws error if m and the calling object do not have the same dimension
+  /// @param m of type const Symmetric_Banded_Matrix<T>&
+  Symmetric_Banded_Matrix<T> operator+(const Symmetric_Banded_Matrix<T>& m) const;
+  //! Addition operator for any other type of matrix
+  /// \pre calling object and m must be of equal dimension. Operator+ for (T+T) must be defined
+  /// \post returns the sum of the matrcies. Throws error if m and the calling object are of not equal dimension
+  /// @param m of type const Abstract_Matrix<T>&
+  virtual Matrix<T> operator+(const Abstract_Matrix<T>& m) const;
+  //! Substraction operator for Symmetric_Banded_Matrix
+  /// \pre calling object and m must be of equal dimension. Operator- for (T-T) must be defined
+  /// \post returns the difference of the matricies, with the larger of the two bandwidths. throws error if m and the calling object do not have the same dimension
+  /// @param m of type const Symmetric_Banded_Matrix<T>&
+  Symmetric_Banded_Matrix<T> operator-(const Symmetric_Banded_Matrix<T>& m) const;
+  //! Substraction operator for and other type of matrix
+  /// \pre calling object and m must be of equal dimension. Operator- for (T-T) must be defined
+  /// \post returns the difference of the matricies. throws error if m and the calling object do not have the same dimension
+  /// @param m of type const Abstract_Matrix<T>&
+  virtual Matrix<T> operator-(const Abstract_Matrix<T>& m) const;
+  //! Unary operator-
+  /// \pre Unary operator- for T must be defined
+  /// \post Returns the matrix with all the element negated
+  Symmetric_Banded_Matrix<T> operator-() const;
+  //! Scalar multiplcaiton
+  /// \pre operator* must be defined such that (double*T) = T
+  /// \post returns the matrix with each element multiplied by factor
+  /// @param factor of type double
+  Symmetric_Banded_Matrix<T> operator*(double factor) const;
+  //! Matrix multiplcaiton operator for any matrix
+  /// \pre num_cols() for the calling object is equal to the number of rows in m
+  /// \post Returns the product of the matrcies. Throws error if the number fo columns in the calling object are not equal to the rows in m
+  /// @param m of type Abstract_Matrix<T>&
+  virtual Matrix<T> operator*(const Abstract_Matrix<T>& m) const;
+  //! Transpose of the matrix
+  /// \pre None
+  /// \post Retunrs the transpose of the matrix, which is the matrix itself.
+  Symmetric_Banded_Matrix<T> transpose() const;
+  //! Vector multiplcaiton operator
+  /// \pre size of v must be the same as the number of columns in the matrix
+  /// \post returns the vector b of Ax = b, only touching elements inside the band. Throws error if the size of v is not the same as the number of columns in the matrix
+  /// @param v of type const Vector<T>&
+  virtual Vector<T> operator*(const Vector<T>& v) const;
+  //! Assignment operator
+  /// \pre None
+  /// \post Calling Object is now equal to m
+  /// @param m of type Symmetric_Banded_Matrix<T>
+  Symmetric_Banded_Matrix<T>& operator=(Symmetric_Banded_Matrix<T> m);
+  //! Get a column vector
+  /// \pre 0 <= index < num_cols()
+  /// \post returns the column vector at the index. Throws error if the inequality in the precondition is not satisfied
+  /// @param index of type unsigned int
+  virtual Vector<T> col_vector(unsigned int index) const;
+  //! Return the number of rows in the matrix
+  /// \pre None
+  /// \post Returns the number of rows in the matrix
+  virtual unsigned int num_rows() const;
+  //! Return the number of columns in the matrix
+  /// \pre None
+  /// \post Returns the number of columns in the matrix
+  virtual unsigned int num_cols() const;
+  //! Return the bandwidth of the matrix
+  /// \pre None
+  /// \post Returns the number of sub-diagonals stored below the main diagonal
+  unsigned int bandwidth() const;
+  //! Raw pointer to the band
+  /// \pre None
+  /// \post Returns pointer to the stored elements. Element (row, col) with row-bandwidth() <= col <= row is at (row+1)*bandwidth() + col, so the stored part of each row is contiguous. No range checking is done through it
+  T* data();
+  //! Raw pointer to the band (calling object not mutable in this version)
+  /// \pre None
+  /// \post Returns const pointer to the stored elements, laid out as for data(). No range checking is done through it
+  const T* data() const;
+  //! Indexing operator
+  /// \pre 0 <= row < num_rows() and 0 <= col < num_cols()
+  /// \post Return the the specified index, zero if it lies outside the band. Throws error if either inequalities in the pre condtiion are not satisfied
+  /// @param row of type unsigned int
+  /// @param col of type unsigned int
+  virtual T operator()(unsigned int row, unsigned int col) const;
+  //! Returns a reference to an element
+  /// \pre 0 <= row < num_rows and 0 <= col < num_cols, and |row - col| <= bandwidth()
+  /// \post returns a reference to the specified element. Throws error if either of the inequalities are not satisfied and throws and error if the element lies outside the band
+  /// @param row of type unsigned int
+  /// @param col of type unsigned int
+  virtual T& get_elem(unsigned int row, unsigned int col);
+
+  //! Swap operation
+  /// \pre None
+  /// \post Swaps the contents of m1 and m2
+  /// @param m1 of type Symmetric_Banded_Matrix<T>&
+  /// @param m2 of type Symmetric_Banded_Matrix<T>&
+  friend void swap(Symmetric_Banded_Matrix<T>& m1, Symmetric_Banded_Matrix<T>& m2)
+  {
+    std::swap(m1.m_n, m2.m_n);
+    std::swap(m1.m_bandwidth, m2.m_bandwidth);
+    std::swap(m1.m_total_elements, m2.m_total_elements);
+    std::swap(m1.m_elements, m2.m_elements);
+  }
+
+  //! Extration operator
+  /// \pre None
+  /// \post places elements in stream and returns it
+  /// @param os of type ostream&
+  /// @param m of type const Symmetric_Banded_Matrix<T>&
+  friend std::ostream& operator<<(std::ostream& os, const Symmetric_Banded_Matrix<T>& m)
+  {
+    for(unsigned int i = 0; i < m.m_n; i++)
+    {
+      for(unsigned int j = 0; j < m.m_n; j++)
+      {
+        os << m(i, j) << " ";
+      }
+      os << std::endl;
+    }
+    return os;
+  }
+
+  //! insertion operator
+  /// \pre Input must be valid. Elements outside the band are read and discarded.
+  /// \post inserts from istream into the matrix row by row. Throws error if Input is invalid
+  /// @param in of type istream&
+  /// @param m of type const Symmetric_Banded_Matrix<T>&
+  friend std::istream& operator>>(std::istream& in, Symmetric_Banded_Matrix<T>& m)
+  {
+    double throw_away;
+    for(unsigned int i = 0; i < m.m_n; i++)
+    {
+      for(unsigned int j = 0; j < m.m_n; j++)
+      {
+        if(!in || in.eof())
+          throw InputError();
+        if(i < j || i-j > m.m_bandwidth)
+          in >> throw_away;
+        else
+          in >> m.get_elem(i, j);
+      }
+    }
+    return in;
+  }
+};
+
+#include "symmetric_banded_matrix.hpp"
+#endif
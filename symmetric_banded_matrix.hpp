@@ -0,0 +1,279 @@
+/**
+ *  @file symmetric_banded_matrix.hpp
+ *  @brief Class implmentation for symmetric banded matrix
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <utility>
+#include <algorithm>
+#include "Array.h"
+#include "vector.h"
+#include "RangeError.h"
+#include "DimensionError.h"
+#include "MatrixDimError.h"
+#include "ModificationError.h"
+
+template <typename T>
+Symmetric_Banded_Matrix<T>::Symmetric_Banded_Matrix(unsigned int n, unsigned int bandwidth)
+{
+  m_n = n;
+  //A band wider than the matrix holds nothing extra
+  m_bandwidth = (n > 0 && bandwidth >= n) ? n-1 : bandwidth;
+  m_total_elements = m_n*(m_bandwidth+1);
+  m_elements = Array<T>(m_total_elements);
+}
+
+template <typename T>
+Symmetric_Banded_Matrix<T>::Symmetric_Banded_Matrix(const Symmetric_Banded_Matrix<T>& m)
+{
+  m_n = m.m_n;
+  m_bandwidth = m.m_bandwidth;
+  m_total_elements = m.m_total_elements;
+  m_elements = m.m_elements;
+}
+
+template <typename T>
+Symmetric_Banded_Matrix<T>::Symmetric_Banded_Matrix(const Abstract_Matrix<T>& m)
+{
+  if(m.num_rows() != m.num_cols())
+    throw MatrixDimError(m.num_rows(), m.num_cols());
+  m_n = m.num_rows();
+
+  //Find the furthest non-zero element from the diagonal
+  m_bandwidth = 0;
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    for(unsigned int j = 0; j < i; j++)
+    {
+      if(m(i, j) != m(j, i))
+        throw ModificationError();
+      if(m(i, j) != 0 && i-j > m_bandwidth)
+        m_bandwidth = i-j;
+    }
+  }
+
+  m_total_elements = m_n*(m_bandwidth+1);
+  m_elements = Array<T>(m_total_elements);
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    for(unsigned int j = (i > m_bandwidth ? i-m_bandwidth : 0); j <= i; j++)
+      get_elem(i, j) = m(i, j);
+  }
+}
+
+template <typename T>
+Symmetric_Banded_Matrix<T>::Symmetric_Banded_Matrix(Symmetric_Banded_Matrix<T>&& m)
+{
+  m_n = std::move(m.m_n);
+  m_bandwidth = std::move(m.m_bandwidth);
+  m_total_elements = std::move(m.m_total_elements);
+  m_elements = std::move(m.m_elements);
+}
+
+template <typename T>
+Symmetric_Banded_Matrix<T> Symmetric_Banded_Matrix<T>::operator+(const Symmetric_Banded_Matrix<T>& m) const
+{
+  if(m_n != m.m_n)
+    throw MatrixDimError(m_n, m_n);
+  Symmetric_Banded_Matrix<T> temp(m_n, std::max(m_bandwidth, m.m_bandwidth));
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    for(unsigned int j = (i > temp.m_bandwidth ? i-temp.m_bandwidth : 0); j <= i; j++)
+      temp.get_elem(i, j) = operator()(i, j) + m(i, j);
+  }
+  return temp;
+}
+
+template <typename T>
+Matrix<T> Symmetric_Banded_Matrix<T>::operator+(const Abstract_Matrix<T>& m) const
+{
+  if(m_n != m.num_rows() || m_n != m.num_cols())
+    throw MatrixDimError(m_n, m_n);
+  Matrix<T> temp(m_n, m_n);
+  for(unsigned int i = 0; i < m.num_rows(); i++)
+  {
+    for(unsigned int j = 0; j < m.num_cols(); j++)
+    {
+      temp.get_elem(i, j) = operator()(i, j) + m(i, j);
+    }
+  }
+  return temp;
+}
+
+template <typename T>
+Vector<T> Symmetric_Banded_Matrix<T>::col_vector(unsigned int index) const
+{
+  if(index >= m_n)
+    throw RangeError(index);
+  Vector<T> temp(m_n);
+  unsigned int first = (index > m_bandwidth ? index-m_bandwidth : 0);
+  unsigned int last = std::min(m_n-1, index+m_bandwidth);
+  for(unsigned int i = first; i <= last; i++)
+    temp[i] = operator()(i, index);
+  return temp;
+}
+
+template <typename T>
+Symmetric_Banded_Matrix<T> Symmetric_Banded_Matrix<T>::operator-(const Symmetric_Banded_Matrix<T>& m) const
+{
+  return (*this) + (-m);
+}
+
+template <typename T>
+Symmetric_Banded_Matrix<T> Symmetric_Banded_Matrix<T>::operator-() const
+{
+  Symmetric_Banded_Matrix<T> temp(m_n, m_bandwidth);
+  for(unsigned int i = 0; i < m_total_elements; i++)
+    temp.m_elements[i] = -m_elements[i];
+  return temp;
+}
+
+template <typename T>
+Matrix<T> Symmetric_Banded_Matrix<T>::operator-(const Abstract_Matrix<T>& m) const
+{
+  if(m_n != m.num_rows() || m_n != m.num_cols())
+    throw MatrixDimError(m_n, m_n);
+  Matrix<T> temp(m_n, m_n);
+  for(unsigned int i = 0; i < m.num_rows(); i++)
+  {
+    for(unsigned int j = 0; j < m.num_cols(); j++)
+    {
+      temp.get_elem(i, j) = operator()(i, j) - m(i, j);
+    }
+  }
+  return temp;
+}
+
+template <typename T>
+Symmetric_Banded_Matrix<T> Symmetric_Banded_Matrix<T>::operator*(double factor) const
+{
+  Symmetric_Banded_Matrix<T> temp(m_n, m_bandwidth);
+  for(unsigned int i = 0; i < m_total_elements; i++)
+    temp.m_elements[i] = m_elements[i]*factor;
+  return temp;
+}
+
+template <typename T>
+Matrix<T> Symmetric_Banded_Matrix<T>::operator*(const Abstract_Matrix<T>& m) const
+{
+  if(m_n != m.num_rows())
+    throw MatrixDimError(m.num_rows(), m_n);
+  Matrix<T> result(m_n, m.num_cols());
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    //Only the elements inside the band of row i contribute
+    unsigned int first = (i > m_bandwidth ? i-m_bandwidth : 0);
+    unsigned int last = std::min(m_n-1, i+m_bandwidth);
+    for(unsigned int j = 0; j < m.num_cols(); j++)
+    {
+      for(unsigned int k = first; k <= last; k++)
+      {
+        result.get_elem(i, j) += operator()(i, k)* m(k, j);
+      }
+    }
+  }
+  return result;
+}
+
+template <typename T>
+Vector<T> Symmetric_Banded_Matrix<T>::operator*(const Vector<T>& v) const
+{
+  if(m_n != v.size())
+    throw MatrixDimError(m_n, m_n);
+  Vector<T> temp(m_n);
+  //Each stored element below the diagonal is used for both (i, j) and (j, i)
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    unsigned int first = (i > m_bandwidth ? i-m_bandwidth : 0);
+    unsigned int index = i*(m_bandwidth+1) + m_bandwidth - (i-first);
+    for(unsigned int j = first; j < i; j++, index++)
+    {
+      temp[i] += m_elements[index]*v[j];
+      temp[j] += m_elements[index]*v[i];
+    }
+    temp[i] += m_elements[index]*v[i];
+  }
+  return temp;
+}
+
+template <typename T>
+Symmetric_Banded_Matrix<T> Symmetric_Banded_Matrix<T>::transpose() const
+{
+  //transpose of a symmetric matrix is itself, by defintion
+  return (*this);
+}
+
+template <typename T>
+Symmetric_Banded_Matrix<T>& Symmetric_Banded_Matrix<T>::operator=(Symmetric_Banded_Matrix<T> m)
+{
+  swap((*this), m);
+  return *this;
+}
+
+template <typename T>
+unsigned int Symmetric_Banded_Matrix<T>::num_rows() const
+{
+  return m_n;
+}
+
+template <typename T>
+unsigned int Symmetric_Banded_Matrix<T>::num_cols() const
+{
+  return m_n;
+}
+
+template <typename T>
+unsigned int Symmetric_Banded_Matrix<T>::bandwidth() const
+{
+  return m_bandwidth;
+}
+
+template <typename T>
+T* Symmetric_Banded_Matrix<T>::data()
+{
+  return m_elements.data();
+}
+
+template <typename T>
+const T* Symmetric_Banded_Matrix<T>::data() const
+{
+  return m_elements.data();
+}
+
+template <typename T>
+T Symmetric_Banded_Matrix<T>::operator()(unsigned int row, unsigned int col) const
+{
+  if(row >= m_n)
+    throw RangeError(row);
+  if(col >= m_n)
+    throw RangeError(col);
+
+  if(row < col)
+    std::swap(row, col);
+  if(row-col > m_bandwidth)
+    return 0;
+
+  //Convert the rows and cols into an index for the array of elements.
+  unsigned int index = row*(m_bandwidth+1) + m_bandwidth - (row-col);
+  return m_elements[index];
+}
+
+template <typename T>
+T& Symmetric_Banded_Matrix<T>::get_elem(unsigned int row, unsigned int col)
+{
+  if(row >= m_n)
+    throw RangeError(row);
+  if(col >= m_n)
+    throw RangeError(col);
+
+  if(row < col)
+    std::swap(row, col);
+  //Elements outside of the band are not stored
+  if(row-col > m_bandwidth)
+    throw ModificationError();
+
+  //Convert the rows and cols into an index for the array of elements.
+  unsigned int index = row*(m_bandwidth+1) + m_bandwidth - (row-col);
+  return m_elements[index];
+}
@@ -9,7 +9,7 @@
 
 #include "vector.h"
 #include "abstract_matrix.h"
-#include "Array.h"
+#include "Aligned_Array.h"
 
 //Forward declare class
 template <typename T>
@@ -26,7 +26,7 @@ class Symmetric_Matrix : public Abstract_Matrix<T>
 private:
   unsigned int m_n; //!< number of rows and cols for the matrix
   unsigned int m_total_elements; //!< total number of non-zero elements in the array
-  Array<T> m_elements; //!< Array of elements
+  Aligned_Array<T> m_elements; //!< Array of elements, the lower triangle packed row by row
 public:
   //! Default Constructor
   /// \pre None
@@ -6,7 +6,8 @@
 */
 
 #include <utility>
-#include "Array.h"
+#include "Aligned_Array.h"
+#include "vector_kernels.h"
 #include "vector.h"
 #include "RangeError.h"
 #include "DimensionError.h"
@@ -18,7 +19,7 @@ Symmetric_Matrix<T>::Symmetric_Matrix(unsigned int n)
 {
   m_n = n;
   m_total_elements = n*(n+1)/2;
-  m_elements = Array<T>(m_total_elements);
+  m_elements = Aligned_Array<T>(m_total_elements);
 }
 
 template <typename T>
@@ -36,7 +37,7 @@ Symmetric_Matrix<T>::Symmetric_Matrix(const Abstract_Matrix<T>& m)
     throw MatrixDimError(m.num_rows(), m.num_cols());
   m_n = m.num_rows();
   m_total_elements = m_n*(m_n+1)/2;
-  m_elements = Array<T>(m_total_elements);
+  m_elements = Aligned_Array<T>(m_total_elements);
   int counter = 0;
   for(unsigned int i = 0; i < m.num_rows(); i++)
   {
@@ -163,9 +164,19 @@ Vector<T> Symmetric_Matrix<T>::operator*(const Vector<T>& v) const
 {
   if(m_n != v.size())
     throw MatrixDimError(m_n, m_n);
-  Matrix<T> temp(v.size(), 1);
-  temp.set_col(0, v);
-  return ((*this)*temp).col_vector(0);
+  Vector<T> result(m_n);
+  const T* row = m_elements.data();
+  const T* x = v.data();
+  T* y = result.data();
+  //One pass over the packed lower triangle. Row i holds a(i,0..i), it gives
+  //the lower part of y[i] and, by symmetry, column i of the upper part of y[0..i-1]
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    y[i] += static_cast<T>(Vector_Kernels<T>::dot(row, x, i)) + row[i]*x[i];
+    Vector_Kernels<T>::axpy(x[i], row, y, i);
+    row += i+1;
+  }
+  return result;
 }
 
 template <typename T>
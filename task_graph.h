@@ -0,0 +1,78 @@
+#ifndef TASK_GRAPH_H
+#define TASK_GRAPH_H
+
+/**
+ *  @file task_graph.h
+ *  @brief Class defintion for task graph
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <deque>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <exception>
+#include <functional>
+#include "thread_pool.h"
+
+///
+/// \class Task_Graph
+/// \brief This class runs tasks in the order given by their dependencies.
+///        A task is handed to the pool the moment the last task it depends
+///        on finishes, so independent work from different steps of an
+///        algorithm overlaps and no thread waits for a whole step to end.
+///        A task may only depend on tasks added before it, which keeps the
+///        graph free of cycles.
+///
+
+class Task_Graph
+{
+private:
+  //! One task and its place in the graph
+  struct Task
+  {
+    std::function<void()> m_work; //!< what the task does
+    unsigned int m_dependencies; //!< number of tasks that must finish first
+    std::atomic<unsigned int> m_waiting; //!< tasks still to finish before this one is ready, while running
+    std::vector<unsigned int> m_successors; //!< tasks that depend on this one
+  };
+  std::deque<Task> m_tasks; //!< tasks in the order added, a deque so they never move
+  std::atomic<unsigned int> m_remaining; //!< tasks not yet finished, while running
+  std::atomic<bool> m_failed; //!< set once a task has thrown, later tasks are skipped
+  std::mutex m_errorMutex; //!< guards m_error
+  std::exception_ptr m_error; //!< the first error thrown by a task
+  //! Runs one task
+  /// \pre Every task that task depends on has finished
+  /// \post The task has run, unless an earlier one threw, and its successors that became ready are handed to pool
+  void execute(unsigned int task, Thread_Pool& pool);
+public:
+  //! Constructor
+  /// \pre None
+  /// \post Task_Graph object created with no tasks
+  Task_Graph():m_remaining(0),m_failed(false){}
+  //! Adds a task
+  /// \pre None
+  /// \post work is added as a task with no dependencies, and its index is returned
+  /// @param work of type std::function<void()>
+  unsigned int add(std::function<void()> work);
+  //! Adds a dependency
+  /// \pre before < after < the number of tasks
+  /// \post Task after will not start until task before has finished. Throws error if either task does not exist or before is not added before after
+  /// @param before of type unsigned int
+  /// @param after of type unsigned int
+  void depend(unsigned int before, unsigned int after);
+  //! Runs the graph
+  /// \pre No other call to run() is in progress
+  /// \post Every task has run on the threads of pool, each after all its dependencies. If a task throws, the tasks not started yet are skipped and the first error is thrown again here
+  /// @param pool of type Thread_Pool&
+  void run(Thread_Pool& pool);
+  //! Returns the number of tasks
+  /// \pre None
+  /// \post Returns the number of tasks added
+  unsigned int size() const;
+};
+
+#include "task_graph.hpp"
+
+#endif
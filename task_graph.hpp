@@ -0,0 +1,85 @@
+/**
+ *  @file task_graph.hpp
+ *  @brief Class implmentation for task graph
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <mutex>
+#include <exception>
+#include "RangeError.h"
+#include "InputError.h"
+
+inline unsigned int Task_Graph::add(std::function<void()> work)
+{
+  m_tasks.emplace_back();
+  Task& task = m_tasks.back();
+  task.m_work = std::move(work);
+  task.m_dependencies = 0;
+  task.m_waiting = 0;
+  return static_cast<unsigned int>(m_tasks.size()-1);
+}
+
+inline void Task_Graph::depend(unsigned int before, unsigned int after)
+{
+  if(after >= m_tasks.size())
+    throw RangeError(after);
+  if(before >= after)
+    throw InputError();
+  m_tasks[before].m_successors.push_back(after);
+  m_tasks[after].m_dependencies++;
+}
+
+inline void Task_Graph::execute(unsigned int task, Thread_Pool& pool)
+{
+  Task& current = m_tasks[task];
+  if(!m_failed)
+  {
+    try
+    {
+      current.m_work();
+    }
+    catch(...)
+    {
+      std::lock_guard<std::mutex> lock(m_errorMutex);
+      if(!m_failed)
+        m_error = std::current_exception();
+      m_failed = true;
+    }
+  }
+
+  //Successors go on the queue of this thread, newest first, so the one
+  //added first to the graph is the next this thread runs
+  for(unsigned int k = static_cast<unsigned int>(current.m_successors.size()); k > 0; k--)
+  {
+    unsigned int next = current.m_successors[k-1];
+    if(--m_tasks[next].m_waiting == 0)
+      pool.submit([this, next, &pool]{ execute(next, pool); });
+  }
+  if(--m_remaining == 0)
+    pool.notify();
+}
+
+inline void Task_Graph::run(Thread_Pool& pool)
+{
+  if(m_tasks.empty())
+    return;
+  m_failed = false;
+  m_error = nullptr;
+  m_remaining = static_cast<unsigned int>(m_tasks.size());
+  for(unsigned int t = 0; t < m_tasks.size(); t++)
+    m_tasks[t].m_waiting = m_tasks[t].m_dependencies;
+  for(unsigned int t = static_cast<unsigned int>(m_tasks.size()); t > 0; t--)
+    if(m_tasks[t-1].m_dependencies == 0)
+      pool.submit([this, t, &pool]{ execute(t-1, pool); });
+
+  //The caller runs tasks too until the last one is done
+  pool.run_until([this]{ return m_remaining == 0; });
+  if(m_error)
+    std::rethrow_exception(m_error);
+}
+
+inline unsigned int Task_Graph::size() const
+{
+  return static_cast<unsigned int>(m_tasks.size());
+}
@@ -0,0 +1,191 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+/**
+ *  @file thread_pool.h
+ *  @brief Class defintion for thread pool
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <deque>
+#include <utility>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <future>
+#include <type_traits>
+#include <functional>
+#include <condition_variable>
+#include "Array.h"
+
+///
+/// \class Thread_Pool
+/// \brief This class is a work stealing pool of threads. Each thread of the
+///        pool keeps its own queue of tasks. A thread takes the newest task
+///        of its own queue, so work it just made runs while its data is in
+///        cache, and when its queue is empty it steals the oldest task of
+///        another queue. Threads that are not in the pool, like the one that
+///        made it, share one more queue, and help run tasks while they wait
+///        with run_until(). On top of the queues are parallel loops,
+///        reductions and futures. A reduction in deterministic mode splits
+///        its range by the grain alone and combines the parts in order, so
+///        its result is the same bit for bit on every run and for any number
+///        of threads. The shared pool is sized by configure(), or by the
+///        environment variables POOL_THREADS and POOL_DETERMINISTIC.
+///
+
+class Thread_Pool
+{
+private:
+  //! Task queue of one thread
+  struct Queue
+  {
+    std::mutex m_mutex; //!< guards the tasks
+    std::deque<std::function<void()>> m_tasks; //!< tasks, the newest at the back
+  };
+  unsigned int m_threads; //!< number of threads running tasks, counting one for the caller
+  Array<Queue> m_queues; //!< queue 0 is shared by outside threads, queue t by pool thread t
+  Array<std::thread> m_workers; //!< pool threads, m_workers[t] for t from 1 to m_threads-1
+  std::mutex m_mutex; //!< guards sleeping and waking
+  std::condition_variable m_condition; //!< waited on by threads with nothing to run
+  std::atomic<unsigned int> m_pending; //!< tasks submitted and not yet taken, counted before they reach a queue
+  std::atomic<bool> m_deterministic; //!< true when reductions must not depend on timing or the number of threads
+  bool m_stop; //!< set when the pool is destroyed
+  static const unsigned int TASK_WORK = 8192; //!< fewest elements worth a task of their own, fewer cost more to hand out than to compute
+  //! Settings of the shared pool
+  struct Settings
+  {
+    unsigned int m_threads; //!< threads of the shared pool, 0 for every core
+    bool m_deterministic; //!< starting mode of the shared pool
+    bool m_made; //!< true once the shared pool exists
+  };
+  //! Settings of the shared pool
+  /// \pre None
+  /// \post Returns the settings, read from the environment on the first call
+  static Settings& settings();
+  //! Settings given by the environment
+  /// \pre None
+  /// \post Returns the settings of POOL_THREADS and POOL_DETERMINISTIC, with every core and a non-deterministic mode where they are not set
+  static Settings environment();
+  //! Threads of the shared pool
+  /// \pre Called only to make the shared pool
+  /// \post Returns the configured number of threads, and marks the shared pool as made
+  static unsigned int shared_threads();
+  //! Pool and index of the calling thread
+  /// \pre None
+  /// \post Returns the pool the calling thread belongs to and its index there, or a null pool for a thread in no pool
+  static std::pair<const Thread_Pool*, unsigned int>& identity();
+  //! Queue of the calling thread
+  /// \pre None
+  /// \post Returns the index in m_queues of the pool thread calling, or 0 for any other thread
+  unsigned int own_queue() const;
+  //! Takes a task
+  /// \pre queue < m_threads
+  /// \post Returns true and moves a task into task if one was queued. The newest task of queue is tried first, then the oldest of the others
+  bool take(unsigned int queue, std::function<void()>& task);
+  //! Work of one pool thread
+  /// \pre Called once by pool thread index
+  /// \post Runs tasks until the pool is destroyed
+  void worker(unsigned int index);
+  //! Runs numbered pieces of work
+  /// \pre None
+  /// \post chunk(c) has run for every c < chunks, chunk(0) on the calling thread. If any throws, the first error is thrown again here once all have finished
+  void run_chunks(unsigned int chunks, const std::function<void(unsigned int)>& chunk);
+  //! Size of the pieces of a loop
+  /// \pre grain > 0
+  /// \post Returns a size of at least grain that gives each thread a few pieces of count items
+  unsigned int chunk_size(unsigned int count, unsigned int grain) const;
+public:
+  //! Constructor
+  /// \pre None
+  /// \post Thread_Pool object created with threads-1 pool threads, the caller being the other one. threads = 0 uses every core. Reductions are deterministic if deterministic is true
+  /// @param threads of type unsigned int
+  /// @param deterministic of type bool
+  Thread_Pool(unsigned int threads = 0, bool deterministic = false);
+  //! Destructor
+  /// \pre No task is left that some thread waits on
+  /// \post The queued tasks are run and the pool threads are joined
+  ~Thread_Pool();
+  //! Adds a task
+  /// \pre task does not throw
+  /// \post task is queued, on the queue of the calling thread if it is in the pool, and is run by some thread
+  /// @param task of type std::function<void()>
+  void submit(std::function<void()> task);
+  //! Runs one queued task
+  /// \pre None
+  /// \post Returns true if a task was taken and run by the calling thread, false if the queues were empty
+  bool run_pending();
+  //! Helps until a condition holds
+  /// \pre notify() is called after whatever makes done() true
+  /// \post Runs queued tasks on the calling thread, or sleeps while there are none, and returns once done() is true
+  /// @param done of type const std::function<bool()>&
+  void run_until(const std::function<bool()>& done);
+  //! Wakes waiting threads
+  /// \pre None
+  /// \post Every thread in run_until() checks its condition again
+  void notify();
+  //! Parallel loop
+  /// \pre body(first, last) can run at the same time for ranges that do not overlap
+  /// \post body has been called on pieces of at least grain items that together cover first to last-1, and on the whole range at once if it is no larger than grain. Throws the first error thrown by body
+  /// @param first of type unsigned int
+  /// @param last of type unsigned int
+  /// @param grain of type unsigned int
+  /// @param body of type const F&
+  template <typename F>
+  void parallel_for(unsigned int first, unsigned int last, unsigned int grain, const F& body);
+  //! Parallel reduction
+  /// \pre body(first, last) returns the value of a range and can run at the same time for ranges that do not overlap. combine(R, R) returns R
+  /// \post Returns identity combined with the values of pieces covering first to last-1. In deterministic mode the pieces are grain items each and are combined in order, otherwise their size depends on the number of threads and they are combined as they finish. Throws the first error thrown by body
+  /// @param first of type unsigned int
+  /// @param last of type unsigned int
+  /// @param grain of type unsigned int
+  /// @param identity of type R
+  /// @param body of type const F&
+  /// @param combine of type const C&
+  template <typename R, typename F, typename C>
+  R parallel_reduce(unsigned int first, unsigned int last, unsigned int grain, R identity, const F& body, const C& combine);
+  //! Runs a task with a result
+  /// \pre None
+  /// \post task is queued, and the returned future holds its result or the error it threw. Wait for it with get() to help the pool in the meantime
+  /// @param task of type F
+  template <typename F>
+  std::future<typename std::result_of<F()>::type> async(F task);
+  //! Waits for a future
+  /// \pre result came from async() on this pool
+  /// \post Runs queued tasks until result is ready, then returns its value. Throws the error of the task if it threw
+  /// @param result of type std::future<R>&
+  template <typename R>
+  R get(std::future<R>& result);
+  //! Sets the reduction mode
+  /// \pre No reduction is running on the pool
+  /// \post Reductions are deterministic if deterministic is true
+  /// @param deterministic of type bool
+  void set_deterministic(bool deterministic);
+  //! Returns the reduction mode
+  /// \pre None
+  /// \post Returns true if reductions are deterministic
+  bool deterministic() const;
+  //! Returns the number of threads
+  /// \pre None
+  /// \post Returns the number of threads running tasks, counting the caller
+  unsigned int size() const;
+  //! Grain for a loop
+  /// \pre None
+  /// \post Returns the number of items of work elements each that is worth a task of its own, at least 1
+  /// @param work of type unsigned int
+  static unsigned int grain(unsigned int work);
+  //! Sets the size of the shared pool
+  /// \pre None
+  /// \post The shared pool has threads threads, 0 for every core, overriding the environment. Throws error if the shared pool was already made with a different number of threads
+  /// @param threads of type unsigned int
+  static void configure(unsigned int threads);
+  //! Returns the pool shared by the whole program
+  /// \pre None
+  /// \post Returns the pool made with the settings of configure() or the environment on the first call
+  static Thread_Pool& shared();
+};
+
+#include "thread_pool.hpp"
+
+#endif
@@ -0,0 +1,344 @@
+/**
+ *  @file thread_pool.hpp
+ *  @brief Class implmentation for thread pool
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <chrono>
+#include "ModificationError.h"
+
+inline std::pair<const Thread_Pool*, unsigned int>& Thread_Pool::identity()
+{
+  //Set once by each pool thread when it starts
+  static thread_local std::pair<const Thread_Pool*, unsigned int> id(nullptr, 0);
+  return id;
+}
+
+inline unsigned int Thread_Pool::own_queue() const
+{
+  const std::pair<const Thread_Pool*, unsigned int>& id = identity();
+  return (id.first == this ? id.second : 0);
+}
+
+inline Thread_Pool::Thread_Pool(unsigned int threads, bool deterministic)
+  :m_threads(threads > 0 ? threads : std::thread::hardware_concurrency()),m_pending(0),m_deterministic(deterministic),m_stop(false)
+{
+  //hardware_concurrency may not know
+  if(m_threads == 0)
+    m_threads = 1;
+  m_queues = Array<Queue>(m_threads);
+  m_workers = Array<std::thread>(m_threads);
+  //The thread that makes the pool is one of its threads whenever it waits
+  for(unsigned int t = 1; t < m_threads; t++)
+    m_workers[t] = std::thread(&Thread_Pool::worker, this, t);
+}
+
+inline Thread_Pool::~Thread_Pool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_condition.notify_all();
+  for(unsigned int t = 1; t < m_threads; t++)
+    m_workers[t].join();
+  //Without pool threads nobody else is left to run them
+  while(run_pending());
+}
+
+inline bool Thread_Pool::take(unsigned int queue, std::function<void()>& task)
+{
+  {
+    Queue& own = m_queues[queue];
+    std::lock_guard<std::mutex> lock(own.m_mutex);
+    if(!own.m_tasks.empty())
+    {
+      task = std::move(own.m_tasks.back());
+      own.m_tasks.pop_back();
+      m_pending--;
+      return true;
+    }
+  }
+  //Steal the oldest task of the next queue that has one, oldest tasks
+  //tend to be the biggest pieces of work left
+  for(unsigned int t = 1; t < m_threads; t++)
+  {
+    Queue& other = m_queues[(queue+t) % m_threads];
+    std::lock_guard<std::mutex> lock(other.m_mutex);
+    if(!other.m_tasks.empty())
+    {
+      task = std::move(other.m_tasks.front());
+      other.m_tasks.pop_front();
+      m_pending--;
+      return true;
+    }
+  }
+  return false;
+}
+
+inline void Thread_Pool::worker(unsigned int index)
+{
+  identity() = std::make_pair(this, index);
+  std::function<void()> task;
+  while(true)
+  {
+    if(take(index, task))
+    {
+      task();
+      task = nullptr;
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if(m_stop && m_pending == 0)
+      return;
+    m_condition.wait(lock, [this]{ return m_stop || m_pending > 0; });
+  }
+}
+
+inline void Thread_Pool::submit(std::function<void()> task)
+{
+  //The task is counted before it is published, so take() never decrements
+  //past zero. Counting under m_mutex means a thread about to sleep either
+  //sees the task or gets the notify
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pending++;
+  }
+  {
+    Queue& queue = m_queues[own_queue()];
+    std::lock_guard<std::mutex> lock(queue.m_mutex);
+    queue.m_tasks.push_back(std::move(task));
+  }
+  m_condition.notify_one();
+}
+
+inline bool Thread_Pool::run_pending()
+{
+  std::function<void()> task;
+  if(!take(own_queue(), task))
+    return false;
+  task();
+  return true;
+}
+
+inline void Thread_Pool::run_until(const std::function<bool()>& done)
+{
+  while(!done())
+  {
+    if(run_pending())
+      continue;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [this, &done]{ return m_pending > 0 || done(); });
+  }
+}
+
+inline void Thread_Pool::notify()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+  }
+  m_condition.notify_all();
+}
+
+inline void Thread_Pool::run_chunks(unsigned int chunks, const std::function<void(unsigned int)>& chunk)
+{
+  if(m_threads == 1 || chunks < 2)
+  {
+    for(unsigned int c = 0; c < chunks; c++)
+      chunk(c);
+    return;
+  }
+  std::atomic<unsigned int> remaining(chunks-1);
+  std::mutex error_mutex;
+  std::exception_ptr error;
+  auto run = [&chunk, &error_mutex, &error](unsigned int c)
+  {
+    try
+    {
+      chunk(c);
+    }
+    catch(...)
+    {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if(!error)
+        error = std::current_exception();
+    }
+  };
+  for(unsigned int c = chunks-1; c > 0; c--)
+  {
+    submit([this, &run, &remaining, c]
+    {
+      run(c);
+      if(--remaining == 0)
+        notify();
+    });
+  }
+  run(0);
+  run_until([&remaining]{ return remaining == 0; });
+  if(error)
+    std::rethrow_exception(error);
+}
+
+inline unsigned int Thread_Pool::chunk_size(unsigned int count, unsigned int grain) const
+{
+  //A few pieces per thread lets the fast threads steal from the slow ones
+  unsigned int pieces = 4*m_threads;
+  return std::max(grain, count/pieces + (count % pieces != 0 ? 1 : 0));
+}
+
+template <typename F>
+void Thread_Pool::parallel_for(unsigned int first, unsigned int last, unsigned int grain, const F& body)
+{
+  if(last <= first)
+    return;
+  unsigned int count = last-first;
+  if(grain == 0)
+    grain = 1;
+  if(m_threads == 1 || count <= grain)
+  {
+    body(first, last);
+    return;
+  }
+  unsigned int size = chunk_size(count, grain);
+  unsigned int chunks = count/size + (count % size != 0 ? 1 : 0);
+  run_chunks(chunks, [first, last, size, &body](unsigned int c)
+  {
+    unsigned int begin = first + c*size;
+    body(begin, begin + std::min(size, last-begin));
+  });
+}
+
+template <typename R, typename F, typename C>
+R Thread_Pool::parallel_reduce(unsigned int first, unsigned int last, unsigned int grain, R identity, const F& body, const C& combine)
+{
+  if(last <= first)
+    return identity;
+  unsigned int count = last-first;
+  if(grain == 0)
+    grain = 1;
+  if(m_deterministic)
+  {
+    //The pieces only depend on the range and the grain, and are combined
+    //in order, whatever the number of threads
+    unsigned int chunks = count/grain + (count % grain != 0 ? 1 : 0);
+    if(chunks == 1)
+      return combine(identity, body(first, last));
+    Array<R> partial(chunks);
+    run_chunks(chunks, [first, last, grain, &body, &partial](unsigned int c)
+    {
+      unsigned int begin = first + c*grain;
+      partial[c] = body(begin, begin + std::min(grain, last-begin));
+    });
+    R total = identity;
+    for(unsigned int c = 0; c < chunks; c++)
+      total = combine(total, partial[c]);
+    return total;
+  }
+
+  if(m_threads == 1 || count <= grain)
+    return combine(identity, body(first, last));
+  unsigned int size = chunk_size(count, grain);
+  unsigned int chunks = count/size + (count % size != 0 ? 1 : 0);
+  std::mutex total_mutex;
+  R total = identity;
+  run_chunks(chunks, [first, last, size, &body, &combine, &total_mutex, &total](unsigned int c)
+  {
+    unsigned int begin = first + c*size;
+    R part = body(begin, begin + std::min(size, last-begin));
+    std::lock_guard<std::mutex> lock(total_mutex);
+    total = combine(total, part);
+  });
+  return total;
+}
+
+template <typename F>
+std::future<typename std::result_of<F()>::type> Thread_Pool::async(F task)
+{
+  typedef typename std::result_of<F()>::type R;
+  //std::function needs a copyable task, so the packaged task is shared
+  std::shared_ptr<std::packaged_task<R()>> job = std::make_shared<std::packaged_task<R()>>(std::move(task));
+  std::future<R> result = job->get_future();
+  submit([this, job]
+  {
+    (*job)();
+    notify();
+  });
+  return result;
+}
+
+template <typename R>
+R Thread_Pool::get(std::future<R>& result)
+{
+  run_until([&result]{ return result.wait_for(std::chrono::seconds(0)) == std::future_status::ready; });
+  return result.get();
+}
+
+inline void Thread_Pool::set_deterministic(bool deterministic)
+{
+  m_deterministic = deterministic;
+}
+
+inline bool Thread_Pool::deterministic() const
+{
+  return m_deterministic;
+}
+
+inline unsigned int Thread_Pool::size() const
+{
+  return m_threads;
+}
+
+inline unsigned int Thread_Pool::grain(unsigned int work)
+{
+  return TASK_WORK/(work+1)+1;
+}
+
+inline Thread_Pool::Settings Thread_Pool::environment()
+{
+  Settings result = {0, false, false};
+  const char* threads = std::getenv("POOL_THREADS");
+  if(threads != nullptr)
+    result.m_threads = static_cast<unsigned int>(std::strtoul(threads, nullptr, 10));
+  const char* deterministic = std::getenv("POOL_DETERMINISTIC");
+  result.m_deterministic = (deterministic != nullptr && *deterministic != '\0' && std::strcmp(deterministic, "0") != 0);
+  return result;
+}
+
+inline Thread_Pool::Settings& Thread_Pool::settings()
+{
+  static Settings current = environment();
+  return current;
+}
+
+inline unsigned int Thread_Pool::shared_threads()
+{
+  Settings& current = settings();
+  current.m_made = true;
+  return current.m_threads;
+}
+
+inline void Thread_Pool::configure(unsigned int threads)
+{
+  Settings& current = settings();
+  //The threads of a pool are fixed once it is made
+  if(current.m_made && threads != 0 && threads != shared().size())
+    throw ModificationError();
+  current.m_threads = threads;
+}
+
+inline Thread_Pool& Thread_Pool::shared()
+{
+  //Initialization of a local static happens once, even with several threads
+  static Thread_Pool pool(shared_threads(), settings().m_deterministic);
+  return pool;
+}
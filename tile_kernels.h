@@ -0,0 +1,71 @@
+#ifndef TILE_KERNELS_H
+#define TILE_KERNELS_H
+
+/**
+ *  @file tile_kernels.h
+ *  @brief Class defintion for tile kernels
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+///
+/// \class Tile_Kernels
+/// \brief This class holds the BLAS-3 style kernels of the tiled cholesky
+///        decomposition. Tiles are row major blocks given by a pointer to
+///        their first element and a row stride. The inner loops are the
+///        vectorized dot product of Vector_Kernels and the register tiled
+///        micro kernel of Gemm, neither of which branches per element.
+///
+
+template <typename T>
+class Tile_Kernels
+{
+private:
+  static const unsigned int SYRK_BLOCK = 32; //!< rows of C updated by one call to Gemm in syrk()
+public:
+  //! Cholesky factorization of a tile
+  /// \pre a is an n x n tile with stride lda holding a positive definite matrix in its lower triangle
+  /// \post The lower triangle of a holds L with a = L(L^T). Throws error if a is not positive definite or is singular
+  /// @param n of type unsigned int
+  /// @param a of type T*
+  /// @param lda of type unsigned int
+  static void potrf(unsigned int n, T* a, unsigned int lda);
+  //! Triangular solve with the transpose of a factored tile
+  /// \pre l is an n x n tile with stride ldl holding a lower triangular factor. b is an m x n tile with stride ldb
+  /// \post b holds b(L^-T)
+  /// @param m of type unsigned int
+  /// @param n of type unsigned int
+  /// @param l of type const T*
+  /// @param ldl of type unsigned int
+  /// @param b of type T*
+  /// @param ldb of type unsigned int
+  static void trsm(unsigned int m, unsigned int n, const T* l, unsigned int ldl, T* b, unsigned int ldb);
+  //! Symmetric rank k update
+  /// \pre a is an n x k tile with stride lda and c is an n x n tile with stride ldc
+  /// \post The lower triangle of c holds c - a(a^T). Elements above the diagonal of c are changed as well, and are not meaningful afterwards
+  /// @param n of type unsigned int
+  /// @param k of type unsigned int
+  /// @param a of type const T*
+  /// @param lda of type unsigned int
+  /// @param c of type T*
+  /// @param ldc of type unsigned int
+  static void syrk(unsigned int n, unsigned int k, const T* a, unsigned int lda, T* c, unsigned int ldc);
+  //! General update with a transposed tile
+  /// \pre a is an m x k tile with stride lda, b is an n x k tile with stride ldb and c is an m x n tile with stride ldc
+  /// \post c holds c - a(b^T)
+  /// @param m of type unsigned int
+  /// @param n of type unsigned int
+  /// @param k of type unsigned int
+  /// @param a of type const T*
+  /// @param lda of type unsigned int
+  /// @param b of type const T*
+  /// @param ldb of type unsigned int
+  /// @param c of type T*
+  /// @param ldc of type unsigned int
+  static void gemm(unsigned int m, unsigned int n, unsigned int k, const T* a, unsigned int lda,
+                   const T* b, unsigned int ldb, T* c, unsigned int ldc);
+};
+
+#include "tile_kernels.hpp"
+
+#endif
@@ -0,0 +1,75 @@
+/**
+ *  @file tile_kernels.hpp
+ *  @brief Class implmentation for tile kernels
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#include <math.h>
+#include <algorithm>
+#include "vector_kernels.h"
+#include "gemm.h"
+#include "SingularError.h"
+#include "PositiveDefError.h"
+
+//Definition for the blocking constant, it is bound to a reference by std::min
+template <typename T>
+const unsigned int Tile_Kernels<T>::SYRK_BLOCK;
+
+template <typename T>
+void Tile_Kernels<T>::potrf(unsigned int n, T* a, unsigned int lda)
+{
+  double tolerance = 1.0E-30;
+  //Column by column, every element is a dot product of two rows of the
+  //tile that are already final up to that column
+  for(unsigned int c = 0; c < n; c++)
+  {
+    T* pivot_row = a + c*lda;
+    double diagonal = pivot_row[c] - Vector_Kernels<T>::dot(pivot_row, pivot_row, c);
+    if(diagonal < 0)
+      throw PositiveDefError();
+    pivot_row[c] = static_cast<T>(sqrt(diagonal));
+    if(fabs(pivot_row[c]) < tolerance)
+      throw SingularError();
+    for(unsigned int i = c+1; i < n; i++)
+    {
+      T* row = a + i*lda;
+      row[c] = static_cast<T>((row[c] - Vector_Kernels<T>::dot(row, pivot_row, c)) / pivot_row[c]);
+    }
+  }
+}
+
+template <typename T>
+void Tile_Kernels<T>::trsm(unsigned int m, unsigned int n, const T* l, unsigned int ldl, T* b, unsigned int ldb)
+{
+  //Each row x of the result solves L(x^T) = b^T, a forward substitution
+  for(unsigned int i = 0; i < m; i++)
+  {
+    T* row = b + i*ldb;
+    for(unsigned int c = 0; c < n; c++)
+    {
+      const T* l_row = l + c*ldl;
+      row[c] = static_cast<T>((row[c] - Vector_Kernels<T>::dot(row, l_row, c)) / l_row[c]);
+    }
+  }
+}
+
+template <typename T>
+void Tile_Kernels<T>::syrk(unsigned int n, unsigned int k, const T* a, unsigned int lda, T* c, unsigned int ldc)
+{
+  //Each block of rows is updated up to its own last column, so only small
+  //triangles above the diagonal are computed for nothing
+  Gemm<T> gemm;
+  for(unsigned int first = 0; first < n; first += SYRK_BLOCK)
+  {
+    unsigned int last = std::min(n, first+SYRK_BLOCK);
+    gemm.subtract_transposed(last-first, last, k, a + first*lda, lda, a, lda, c + first*ldc, ldc);
+  }
+}
+
+template <typename T>
+void Tile_Kernels<T>::gemm(unsigned int m, unsigned int n, unsigned int k, const T* a, unsigned int lda,
+                           const T* b, unsigned int ldb, T* c, unsigned int ldc)
+{
+  Gemm<T>().subtract_transposed(m, n, k, a, lda, b, ldb, c, ldc);
+}
@@ -6,19 +6,21 @@
 */
 
 #include <utility>
-#include "Array.h"
+#include "Aligned_Array.h"
 #include "vector.h"
 #include "RangeError.h"
 #include "DimensionError.h"
 #include "MatrixDimError.h"
 #include "ModificationError.h"
+#include "SingularError.h"
+#include "vector_kernels.h"
 
 template <typename T>
 Upper_Matrix<T>::Upper_Matrix(unsigned int n)
 {
   m_n = n;
   m_total_elements = n*(n+1)/2;
-  m_elements = Array<T>(m_total_elements);
+  m_elements = Aligned_Array<T>(m_total_elements);
 }
 
 template <typename T>
@@ -36,7 +38,7 @@ Upper_Matrix<T>::Upper_Matrix(const Abstract_Matrix<T>& m)
     throw MatrixDimError(m.num_rows(), m.num_cols());
   m_n = m.num_rows();
   m_total_elements = m_n*(m_n+1)/2;
-  m_elements = Array<T>(m_total_elements);
+  m_elements = Aligned_Array<T>(m_total_elements);
   int counter = 0;
   for(unsigned int i = 0; i < m.num_rows(); i++)
   {
@@ -46,8 +48,7 @@ Upper_Matrix<T>::Upper_Matrix(const Abstract_Matrix<T>& m)
         throw ModificationError();
       if(i <= j)
       {
-        std::cout << i << ' ' << j << std::endl;
-        m_elements[i] = m(i,j);
+        m_elements[counter] = m(i,j);
         counter++;
       }
     }
@@ -58,7 +59,7 @@ template <typename T>
 Upper_Matrix<T>::Upper_Matrix(Upper_Matrix<T>&& m)
 {
   m_n = std::move(m.m_n);
-  m_total_elements = std::move(m.m_n);
+  m_total_elements = std::move(m.m_total_elements);
   m_elements = std::move(m.m_elements);
 }
 
@@ -174,16 +175,51 @@ Vector<T> Upper_Matrix<T>::operator*(const Vector<T>& v) const
   if(m_n != v.size())
     throw MatrixDimError(m_n, m_n);
   Vector<T> temp(m_n);
+  //Row i is packed as (i, i..m_n-1), so every entry is a dot product over one contiguous run
+  const T* row = m_elements.data();
   for(unsigned int i = 0; i < m_n; i++)
   {
-    for(unsigned int j = i; j < m_n; j++)
-    {
-      temp[i] += operator()(i, j)*v[j];
-    }
+    temp[i] = static_cast<T>(Vector_Kernels<T>::dot(row, v.data()+i, m_n-i));
+    row += m_n-i;
   }
   return temp;
 }
 
+template <typename T>
+void Upper_Matrix<T>::solve_in_place(Vector<T>& b) const
+{
+  if(m_n != b.size())
+    throw DimensionError(b.size());
+  T* x = b.data();
+  for(unsigned int i = m_n; i-- > 0;)
+  {
+    //Start of row i, the rows before it hold m_n, m_n-1, ... elements
+    const T* row = m_elements.data() + i*m_n - i*(i-1)/2;
+    if(row[0] == 0)
+      throw SingularError();
+    x[i] = (x[i] - static_cast<T>(Vector_Kernels<T>::dot(row+1, x+i+1, m_n-i-1))) / row[0];
+  }
+}
+
+template <typename T>
+void Upper_Matrix<T>::solve_transpose_in_place(Vector<T>& b) const
+{
+  if(m_n != b.size())
+    throw DimensionError(b.size());
+  T* x = b.data();
+  //Row i of U is column i of U^T, so once x[i] is known it is taken out of
+  //the entries below it with one axpy over the packed row
+  const T* row = m_elements.data();
+  for(unsigned int i = 0; i < m_n; i++)
+  {
+    if(row[0] == 0)
+      throw SingularError();
+    x[i] /= row[0];
+    Vector_Kernels<T>::axpy(-x[i], row+1, x+i+1, m_n-i-1);
+    row += m_n-i;
+  }
+}
+
 template <typename T>
 Upper_Matrix<T>& Upper_Matrix<T>::operator=(Upper_Matrix<T> m)
 {
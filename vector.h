@@ -9,7 +9,8 @@
 
 #include <iostream>
 #include <string>
-#include "Array.h"
+#include "Aligned_Array.h"
+#include "vector_kernels.h"
 #include "InputError.h"
 
 ///
@@ -20,7 +21,7 @@
 template <typename T>
 class Vector {
 private:
-  Array<T> m_elements; //!< Array of elements for the vector
+  Aligned_Array<T> m_elements; //!< Aligned array of elements for the vector, contiguous so the kernels can vectorize over it
   unsigned int m_n; //!< Number of elements in the vector
 
 public:
@@ -40,7 +41,7 @@ public:
   /// @param init oif type T
   Vector(unsigned int n, T init);
   ///! Copy Constructor
-  /// \pre Array<T> must have the operator = defined
+  /// \pre Aligned_Array<T> must have the operator = defined
   /// \post A copy of v is constructed
   /// @param v of type const Vector<T>&
   Vector(const Vector<T>& v);
@@ -74,12 +75,12 @@ public:
   /// @param factor of type const T&
   Vector<T> operator*(const T& factor) const;
   //! Element accessor
-  /// \pre index is an unsigned integer between 0 and m_n-1, Array must have the operator [] defined
+  /// \pre index is an unsigned integer between 0 and m_n-1, Aligned_Array must have the operator [] defined
   /// \post returns reference to the vectors element at index
   /// @param index of type unsigned int
   T& operator[](unsigned int index);
   //! Element getter (calling object not mutable in this version)
-  /// \pre index is an unsigned integer between 0 and m_n-1, Array must have the operator [] defined
+  /// \pre index is an unsigned integer between 0 and m_n-1, Aligned_Array must have the operator [] defined
   /// \post returns const reference to the vectors element at index
   /// @param index of type unsigned int
   const T& operator[](unsigned int index) const;
@@ -116,6 +117,14 @@ public:
   /// \pre None
   /// \post returns unsigned int of the number of element in the vector
   unsigned int size() const;
+  //! Raw pointer to the elements
+  /// \pre None
+  /// \post Returns pointer to the first of the m_n contiguous elements, no range checking is done through it
+  T* data();
+  //! Raw pointer to the elements (calling object not mutable in this version)
+  /// \pre None
+  /// \post Returns const pointer to the first of the m_n contiguous elements, no range checking is done through it
+  const T* data() const;
   //! String in column vector format
   /// \pre operator<< must be defined for type T
   /// \post returns string formated to represent column vector
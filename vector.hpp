@@ -11,7 +11,8 @@
 #include <math.h>
 #include <string>
 #include <sstream>
-#include "Array.h"
+#include "Aligned_Array.h"
+#include "parallel_kernels.h"
 #include "SizeError.h"
 #include "DimensionError.h"
 
@@ -19,21 +20,21 @@ template <typename T>
 Vector<T>::Vector()
 {
   m_n = 0;
-  m_elements = Array<T>(0);
+  m_elements = Aligned_Array<T>(0);
 }
 
 template <typename T>
 Vector<T>::Vector(unsigned int n)
 {
   m_n = n;
-  m_elements = Array<T>(m_n);
+  m_elements = Aligned_Array<T>(m_n);
 }
 
 template <typename T>
 Vector<T>::Vector(unsigned int n, T init)
 {
   m_n = n;
-  m_elements = Array<T>(m_n);
+  m_elements = Aligned_Array<T>(m_n);
   for(unsigned int i = 0; i < m_n; i++)
     m_elements[i] = init;
 }
@@ -75,10 +76,7 @@ Vector<T> Vector<T>::operator+(const Vector<T>& v) const
   }
 
   Vector<T> temp(m_n);
-  for(unsigned int i = 0; i < m_n; i++)
-  {
-    temp[i] = m_elements[i]+v.m_elements[i];
-  }
+  Parallel_Kernels<T>::add(m_elements.data(), v.m_elements.data(), temp.m_elements.data(), m_n);
   return temp;
 }
 
@@ -100,7 +98,11 @@ Vector<T> Vector<T>::operator-() const
 template <typename T>
 Vector<T> Vector<T>::operator-(const Vector<T>& v) const
 {
-  return ((*this) + (-v));
+  if(m_n != v.m_n)
+    throw DimensionError(m_n);
+  Vector<T> temp(m_n);
+  Parallel_Kernels<T>::subtract(m_elements.data(), v.m_elements.data(), temp.m_elements.data(), m_n);
+  return temp;
 }
 
 template <typename T>
@@ -138,22 +140,16 @@ bool Vector<T>::operator!=(const Vector<T>& v) const
 template <typename T>
 double Vector<T>::operator*(const Vector<T>& v) const
 {
-  double sum = 0;
   if(m_n != v.m_n)
     throw DimensionError(m_n);
-  for(unsigned int i = 0; i < m_n; i++)
-    sum += m_elements[i]*v[i];
-  return sum;
+  return Parallel_Kernels<T>::dot(m_elements.data(), v.m_elements.data(), m_n);
 }
 
 template <typename T>
 Vector<T> Vector<T>::operator*(const T& factor) const
 {
   Vector<T> temp(m_n);
-  for(unsigned int i = 0; i < m_n; i++)
-  {
-    temp[i] = factor*m_elements[i];
-  }
+  Parallel_Kernels<T>::scale(m_elements.data(), factor, temp.m_elements.data(), m_n);
   return temp;
 }
 
@@ -223,6 +219,18 @@ unsigned int Vector<T>::size() const
   return m_n;
 }
 
+template <typename T>
+T* Vector<T>::data()
+{
+  return m_elements.data();
+}
+
+template <typename T>
+const T* Vector<T>::data() const
+{
+  return m_elements.data();
+}
+
 template <typename T>
 std::string Vector<T>::column_format() const
 {
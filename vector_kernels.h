@@ -0,0 +1,172 @@
+#ifndef VECTOR_KERNELS_H
+#define VECTOR_KERNELS_H
+
+/**
+ *  @file vector_kernels.h
+ *  @brief Class defintion for vector kernels
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+//The explicitly vectorized kernels need the GNU target attribute and the x86 intrinsics
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define VECTOR_KERNELS_X86
+#endif
+
+///
+/// \enum Simd_Level
+/// \brief The widest vector instruction set the kernels may use
+///
+
+enum Simd_Level
+{
+  SIMD_SCALAR, //!< plain C++ loops
+  SIMD_SSE2, //!< 128 bit vectors
+  SIMD_AVX2, //!< 256 bit vectors with fused multiply add
+  SIMD_AVX512 //!< 512 bit vectors
+};
+
+//! Detects the instruction set of the running cpu
+/// \pre None
+/// \post Returns the widest Simd_Level the cpu supports
+inline Simd_Level detect_simd_level();
+//! Instruction set used by the kernels
+/// \pre None
+/// \post Returns detect_simd_level(), detected on the first call and then cached
+inline Simd_Level simd_level();
+
+///
+/// \class Vector_Kernels
+/// \brief This class holds the BLAS-1 style kernels used by Vector. The general
+///        version is a plain loop with several accumulators. float and double
+///        have explicitly vectorized versions chosen at run time by simd_level()
+///
+
+template <typename T>
+class Vector_Kernels
+{
+public:
+  //! Dot product
+  /// \pre x and y point to n elements. The product of two T must be representable as a double
+  /// \post Returns the sum of x[i]*y[i], accumulated in double
+  static double dot(const T* x, const T* y, unsigned int n);
+  //! Scaling
+  /// \pre x and z point to n elements, they may be the same
+  /// \post z[i] = alpha*x[i]
+  static void scale(const T* x, const T& alpha, T* z, unsigned int n);
+  //! Addition
+  /// \pre x, y and z point to n elements, z may be x or y
+  /// \post z[i] = x[i]+y[i]
+  static void add(const T* x, const T* y, T* z, unsigned int n);
+  //! Substraction
+  /// \pre x, y and z point to n elements, z may be x or y
+  /// \post z[i] = x[i]-y[i]
+  static void subtract(const T* x, const T* y, T* z, unsigned int n);
+  //! Scaled addition in place
+  /// \pre x and y point to n elements
+  /// \post y[i] = y[i]+alpha*x[i]
+  static void axpy(const T& alpha, const T* x, T* y, unsigned int n);
+};
+
+///
+/// \class Vector_Kernels<double>
+/// \brief Vectorized kernels for double
+///
+
+template <>
+class Vector_Kernels<double>
+{
+#ifdef VECTOR_KERNELS_X86
+private:
+  static double dot_sse2(const double* x, const double* y, unsigned int n);
+  static double dot_avx2(const double* x, const double* y, unsigned int n);
+  static double dot_avx512(const double* x, const double* y, unsigned int n);
+  static void scale_sse2(const double* x, double alpha, double* z, unsigned int n);
+  static void scale_avx2(const double* x, double alpha, double* z, unsigned int n);
+  static void scale_avx512(const double* x, double alpha, double* z, unsigned int n);
+  static void add_sse2(const double* x, const double* y, double* z, unsigned int n);
+  static void add_avx2(const double* x, const double* y, double* z, unsigned int n);
+  static void add_avx512(const double* x, const double* y, double* z, unsigned int n);
+  static void subtract_sse2(const double* x, const double* y, double* z, unsigned int n);
+  static void subtract_avx2(const double* x, const double* y, double* z, unsigned int n);
+  static void subtract_avx512(const double* x, const double* y, double* z, unsigned int n);
+  static void axpy_sse2(double alpha, const double* x, double* y, unsigned int n);
+  static void axpy_avx2(double alpha, const double* x, double* y, unsigned int n);
+  static void axpy_avx512(double alpha, const double* x, double* y, unsigned int n);
+#endif
+public:
+  //! Dot product
+  /// \pre x and y point to n elements
+  /// \post Returns the sum of x[i]*y[i]
+  static double dot(const double* x, const double* y, unsigned int n);
+  //! Scaling
+  /// \pre x and z point to n elements, they may be the same
+  /// \post z[i] = alpha*x[i]
+  static void scale(const double* x, const double& alpha, double* z, unsigned int n);
+  //! Addition
+  /// \pre x, y and z point to n elements, z may be x or y
+  /// \post z[i] = x[i]+y[i]
+  static void add(const double* x, const double* y, double* z, unsigned int n);
+  //! Substraction
+  /// \pre x, y and z point to n elements, z may be x or y
+  /// \post z[i] = x[i]-y[i]
+  static void subtract(const double* x, const double* y, double* z, unsigned int n);
+  //! Scaled addition in place
+  /// \pre x and y point to n elements
+  /// \post y[i] = y[i]+alpha*x[i]
+  static void axpy(const double& alpha, const double* x, double* y, unsigned int n);
+};
+
+///
+/// \class Vector_Kernels<float>
+/// \brief Vectorized kernels for float. The dot product widens to double before
+///        accumulating, the same as the general version
+///
+
+template <>
+class Vector_Kernels<float>
+{
+#ifdef VECTOR_KERNELS_X86
+private:
+  static double dot_sse2(const float* x, const float* y, unsigned int n);
+  static double dot_avx2(const float* x, const float* y, unsigned int n);
+  static double dot_avx512(const float* x, const float* y, unsigned int n);
+  static void scale_sse2(const float* x, float alpha, float* z, unsigned int n);
+  static void scale_avx2(const float* x, float alpha, float* z, unsigned int n);
+  static void scale_avx512(const float* x, float alpha, float* z, unsigned int n);
+  static void add_sse2(const float* x, const float* y, float* z, unsigned int n);
+  static void add_avx2(const float* x, const float* y, float* z, unsigned int n);
+  static void add_avx512(const float* x, const float* y, float* z, unsigned int n);
+  static void subtract_sse2(const float* x, const float* y, float* z, unsigned int n);
+  static void subtract_avx2(const float* x, const float* y, float* z, unsigned int n);
+  static void subtract_avx512(const float* x, const float* y, float* z, unsigned int n);
+  static void axpy_sse2(float alpha, const float* x, float* y, unsigned int n);
+  static void axpy_avx2(float alpha, const float* x, float* y, unsigned int n);
+  static void axpy_avx512(float alpha, const float* x, float* y, unsigned int n);
+#endif
+public:
+  //! Dot product
+  /// \pre x and y point to n elements
+  /// \post Returns the sum of x[i]*y[i], accumulated in double
+  static double dot(const float* x, const float* y, unsigned int n);
+  //! Scaling
+  /// \pre x and z point to n elements, they may be the same
+  /// \post z[i] = alpha*x[i]
+  static void scale(const float* x, const float& alpha, float* z, unsigned int n);
+  //! Addition
+  /// \pre x, y and z point to n elements, z may be x or y
+  /// \post z[i] = x[i]+y[i]
+  static void add(const float* x, const float* y, float* z, unsigned int n);
+  //! Substraction
+  /// \pre x, y and z point to n elements, z may be x or y
+  /// \post z[i] = x[i]-y[i]
+  static void subtract(const float* x, const float* y, float* z, unsigned int n);
+  //! Scaled addition in place
+  /// \pre x and y point to n elements
+  /// \post y[i] = y[i]+alpha*x[i]
+  static void axpy(const float& alpha, const float* x, float* y, unsigned int n);
+};
+
+#include "vector_kernels.hpp"
+
+#endif
@@ -0,0 +1,691 @@
+/**
+ *  @file vector_kernels.hpp
+ *  @brief Class implmentation for vector kernels
+ *  @author Tanner Wendland
+ *  @author Alex Sanchez
+*/
+
+#ifdef VECTOR_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+inline Simd_Level detect_simd_level()
+{
+#ifdef VECTOR_KERNELS_X86
+  __builtin_cpu_init();
+  if(__builtin_cpu_supports("avx512f"))
+    return SIMD_AVX512;
+  if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    return SIMD_AVX2;
+  if(__builtin_cpu_supports("sse2"))
+    return SIMD_SSE2;
+#endif
+  return SIMD_SCALAR;
+}
+
+inline Simd_Level simd_level()
+{
+  //Initialization of a local static happens once, even with several threads
+  static const Simd_Level level = detect_simd_level();
+  return level;
+}
+
+template <typename T>
+double Vector_Kernels<T>::dot(const T* x, const T* y, unsigned int n)
+{
+  //Four independent sums hide the latency of the floating point add
+  double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  unsigned int i = 0;
+  for(; i+4 <= n; i += 4)
+  {
+    s0 += x[i]*y[i];
+    s1 += x[i+1]*y[i+1];
+    s2 += x[i+2]*y[i+2];
+    s3 += x[i+3]*y[i+3];
+  }
+  for(; i < n; i++)
+    s0 += x[i]*y[i];
+  return (s0+s1)+(s2+s3);
+}
+
+template <typename T>
+void Vector_Kernels<T>::scale(const T* x, const T& alpha, T* z, unsigned int n)
+{
+  for(unsigned int i = 0; i < n; i++)
+    z[i] = alpha*x[i];
+}
+
+template <typename T>
+void Vector_Kernels<T>::add(const T* x, const T* y, T* z, unsigned int n)
+{
+  for(unsigned int i = 0; i < n; i++)
+    z[i] = x[i]+y[i];
+}
+
+template <typename T>
+void Vector_Kernels<T>::subtract(const T* x, const T* y, T* z, unsigned int n)
+{
+  for(unsigned int i = 0; i < n; i++)
+    z[i] = x[i]-y[i];
+}
+
+template <typename T>
+void Vector_Kernels<T>::axpy(const T& alpha, const T* x, T* y, unsigned int n)
+{
+  for(unsigned int i = 0; i < n; i++)
+    y[i] += alpha*x[i];
+}
+
+//--- double ---
+
+inline double Vector_Kernels<double>::dot(const double* x, const double* y, unsigned int n)
+{
+#ifdef VECTOR_KERNELS_X86
+  switch(simd_level())
+  {
+    case SIMD_AVX512:
+      return dot_avx512(x, y, n);
+    case SIMD_AVX2:
+      return dot_avx2(x, y, n);
+    case SIMD_SSE2:
+      return dot_sse2(x, y, n);
+    default:
+      break;
+  }
+#endif
+  double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  unsigned int i = 0;
+  for(; i+4 <= n; i += 4)
+  {
+    s0 += x[i]*y[i];
+    s1 += x[i+1]*y[i+1];
+    s2 += x[i+2]*y[i+2];
+    s3 += x[i+3]*y[i+3];
+  }
+  for(; i < n; i++)
+    s0 += x[i]*y[i];
+  return (s0+s1)+(s2+s3);
+}
+
+inline void Vector_Kernels<double>::scale(const double* x, const double& alpha, double* z, unsigned int n)
+{
+#ifdef VECTOR_KERNELS_X86
+  switch(simd_level())
+  {
+    case SIMD_AVX512:
+      return scale_avx512(x, alpha, z, n);
+    case SIMD_AVX2:
+      return scale_avx2(x, alpha, z, n);
+    case SIMD_SSE2:
+      return scale_sse2(x, alpha, z, n);
+    default:
+      break;
+  }
+#endif
+  for(unsigned int i = 0; i < n; i++)
+    z[i] = alpha*x[i];
+}
+
+inline void Vector_Kernels<double>::add(const double* x, const double* y, double* z, unsigned int n)
+{
+#ifdef VECTOR_KERNELS_X86
+  switch(simd_level())
+  {
+    case SIMD_AVX512:
+      return add_avx512(x, y, z, n);
+    case SIMD_AVX2:
+      return add_avx2(x, y, z, n);
+    case SIMD_SSE2:
+      return add_sse2(x, y, z, n);
+    default:
+      break;
+  }
+#endif
+  for(unsigned int i = 0; i < n; i++)
+    z[i] = x[i]+y[i];
+}
+
+inline void Vector_Kernels<double>::subtract(const double* x, const double* y, double* z, unsigned int n)
+{
+#ifdef VECTOR_KERNELS_X86
+  switch(simd_level())
+  {
+    case SIMD_AVX512:
+      return subtract_avx512(x, y, z, n);
+    case SIMD_AVX2:
+      return subtract_avx2(x, y, z, n);
+    case SIMD_SSE2:
+      return subtract_sse2(x, y, z, n);
+    default:
+      break;
+  }
+#endif
+  for(unsigned int i = 0; i < n; i++)
+    z[i] = x[i]-y[i];
+}
+
+inline void Vector_Kernels<double>::axpy(const double& alpha, const double* x, double* y, unsigned int n)
+{
+#ifdef VECTOR_KERNELS_X86
+  switch(simd_level())
+  {
+    case SIMD_AVX512:
+      return axpy_avx512(alpha, x, y, n);
+    case SIMD_AVX2:
+      return axpy_avx2(alpha, x, y, n);
+    case SIMD_SSE2:
+      return axpy_sse2(alpha, x, y, n);
+    default:
+      break;
+  }
+#endif
+  for(unsigned int i = 0; i < n; i++)
+    y[i] += alpha*x[i];
+}
+
+#ifdef VECTOR_KERNELS_X86
+
+__attribute__((target("sse2")))
+inline double Vector_Kernels<double>::dot_sse2(const double* x, const double* y, unsigned int n)
+{
+  __m128d s0 = _mm_setzero_pd(), s1 = _mm_setzero_pd(), s2 = _mm_setzero_pd(), s3 = _mm_setzero_pd();
+  unsigned int i = 0;
+  for(; i+8 <= n; i += 8)
+  {
+    s0 = _mm_add_pd(s0, _mm_mul_pd(_mm_loadu_pd(x+i), _mm_loadu_pd(y+i)));
+    s1 = _mm_add_pd(s1, _mm_mul_pd(_mm_loadu_pd(x+i+2), _mm_loadu_pd(y+i+2)));
+    s2 = _mm_add_pd(s2, _mm_mul_pd(_mm_loadu_pd(x+i+4), _mm_loadu_pd(y+i+4)));
+    s3 = _mm_add_pd(s3, _mm_mul_pd(_mm_loadu_pd(x+i+6), _mm_loadu_pd(y+i+6)));
+  }
+  for(; i+2 <= n; i += 2)
+    s0 = _mm_add_pd(s0, _mm_mul_pd(_mm_loadu_pd(x+i), _mm_loadu_pd(y+i)));
+  s0 = _mm_add_pd(_mm_add_pd(s0, s1), _mm_add_pd(s2, s3));
+  double lanes[2];
+  _mm_storeu_pd(lanes, s0);
+  double sum = lanes[0]+lanes[1];
+  for(; i < n; i++)
+    sum += x[i]*y[i];
+  return sum;
+}
+
+__attribute__((target("avx2,fma")))
+inline double Vector_Kernels<double>::dot_avx2(const double* x, const double* y, unsigned int n)
+{
+  __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd(), s2 = _mm256_setzero_pd(), s3 = _mm256_setzero_pd();
+  unsigned int i = 0;
+  for(; i+16 <= n; i += 16)
+  {
+    s0 = _mm256_fmadd_pd(_mm256_loadu_pd(x+i), _mm256_loadu_pd(y+i), s0);
+    s1 = _mm256_fmadd_pd(_mm256_loadu_pd(x+i+4), _mm256_loadu_pd(y+i+4), s1);
+    s2 = _mm256_fmadd_pd(_mm256_loadu_pd(x+i+8), _mm256_loadu_pd(y+i+8), s2);
+    s3 = _mm256_fmadd_pd(_mm256_loadu_pd(x+i+12), _mm256_loadu_pd(y+i+12), s3);
+  }
+  for(; i+4 <= n; i += 4)
+    s0 = _mm256_fmadd_pd(_mm256_loadu_pd(x+i), _mm256_loadu_pd(y+i), s0);
+  s0 = _mm256_add_pd(_mm256_add_pd(s0, s1), _mm256_add_pd(s2, s3));
+  __m128d half = _mm_add_pd(_mm256_castpd256_pd128(s0), _mm256_extractf128_pd(s0, 1));
+  double lanes[2];
+  _mm_storeu_pd(lanes, half);
+  double sum = lanes[0]+lanes[1];
+  for(; i < n; i++)
+    sum += x[i]*y[i];
+  return sum;
+}
+
+__attribute__((target("avx512f")))
+inline double Vector_Kernels<double>::dot_avx512(const double* x, const double* y, unsigned int n)
+{
+  __m512d s0 = _mm512_setzero_pd(), s1 = _mm512_setzero_pd(), s2 = _mm512_setzero_pd(), s3 = _mm512_setzero_pd();
+  unsigned int i = 0;
+  for(; i+32 <= n; i += 32)
+  {
+    s0 = _mm512_fmadd_pd(_mm512_loadu_pd(x+i), _mm512_loadu_pd(y+i), s0);
+    s1 = _mm512_fmadd_pd(_mm512_loadu_pd(x+i+8), _mm512_loadu_pd(y+i+8), s1);
+    s2 = _mm512_fmadd_pd(_mm512_loadu_pd(x+i+16), _mm512_loadu_pd(y+i+16), s2);
+    s3 = _mm512_fmadd_pd(_mm512_loadu_pd(x+i+24), _mm512_loadu_pd(y+i+24), s3);
+  }
+  for(; i+8 <= n; i += 8)
+    s0 = _mm512_fmadd_pd(_mm512_loadu_pd(x+i), _mm512_loadu_pd(y+i), s0);
+  double lanes[8];
+  _mm512_storeu_pd(lanes, _mm512_add_pd(_mm512_add_pd(s0, s1), _mm512_add_pd(s2, s3)));
+  double sum = ((lanes[0]+lanes[1])+(lanes[2]+lanes[3]))+((lanes[4]+lanes[5])+(lanes[6]+lanes[7]));
+  for(; i < n; i++)
+    sum += x[i]*y[i];
+  return sum;
+}
+
+__attribute__((target("sse2")))
+inline void Vector_Kernels<double>::scale_sse2(const double* x, double alpha, double* z, unsigned int n)
+{
+  __m128d a = _mm_set1_pd(alpha);
+  unsigned int i = 0;
+  for(; i+2 <= n; i += 2)
+    _mm_storeu_pd(z+i, _mm_mul_pd(a, _mm_loadu_pd(x+i)));
+  for(; i < n; i++)
+    z[i] = alpha*x[i];
+}
+
+__attribute__((target("avx2,fma")))
+inline void Vector_Kernels<double>::scale_avx2(const double* x, double alpha, double* z, unsigned int n)
+{
+  __m256d a = _mm256_set1_pd(alpha);
+  unsigned int i = 0;
+  for(; i+4 <= n; i += 4)
+    _mm256_storeu_pd(z+i, _mm256_mul_pd(a, _mm256_loadu_pd(x+i)));
+  for(; i < n; i++)
+    z[i] = alpha*x[i];
+}
+
+__attribute__((target("avx512f")))
+inline void Vector_Kernels<double>::scale_avx512(const double* x, double alpha, double* z, unsigned int n)
+{
+  __m512d a = _mm512_set1_pd(alpha);
+  unsigned int i = 0;
+  for(; i+8 <= n; i += 8)
+    _mm512_storeu_pd(z+i, _mm512_mul_pd(a, _mm512_loadu_pd(x+i)));
+  for(; i < n; i++)
+    z[i] = alpha*x[i];
+}
+
+__attribute__((target("sse2")))
+inline void Vector_Kernels<double>::add_sse2(const double* x, const double* y, double* z, unsigned int n)
+{
+  unsigned int i = 0;
+  for(; i+2 <= n; i += 2)
+    _mm_storeu_pd(z+i, _mm_add_pd(_mm_loadu_pd(x+i), _mm_loadu_pd(y+i)));
+  for(; i < n; i++)
+    z[i] = x[i]+y[i];
+}
+
+__attribute__((target("avx2,fma")))
+inline void Vector_Kernels<double>::add_avx2(const double* x, const double* y, double* z, unsigned int n)
+{
+  unsigned int i = 0;
+  for(; i+4 <= n; i += 4)
+    _mm256_storeu_pd(z+i, _mm256_add_pd(_mm256_loadu_pd(x+i), _mm256_loadu_pd(y+i)));
+  for(; i < n; i++)
+    z[i] = x[i]+y[i];
+}
+
+__attribute__((target("avx512f")))
+inline void Vector_Kernels<double>::add_avx512(const double* x, const double* y, double* z, unsigned int n)
+{
+  unsigned int i = 0;
+  for(; i+8 <= n; i += 8)
+    _mm512_storeu_pd(z+i, _mm512_add_pd(_mm512_loadu_pd(x+i), _mm512_loadu_pd(y+i)));
+  for(; i < n; i++)
+    z[i] = x[i]+y[i];
+}
+
+__attribute__((target("sse2")))
+inline void Vector_Kernels<double>::subtract_sse2(const double* x, const double* y, double* z, unsigned int n)
+{
+  unsigned int i = 0;
+  for(; i+2 <= n; i += 2)
+    _mm_storeu_pd(z+i, _mm_sub_pd(_mm_loadu_pd(x+i), _mm_loadu_pd(y+i)));
+  for(; i < n; i++)
+    z[i] = x[i]-y[i];
+}
+
+__attribute__((target("avx2,fma")))
+inline void Vector_Kernels<double>::subtract_avx2(const double* x, const double* y, double* z, unsigned int n)
+{
+  unsigned int i = 0;
+  for(; i+4 <= n; i += 4)
+    _mm256_storeu_pd(z+i, _mm256_sub_pd(_mm256_loadu_pd(x+i), _mm256_loadu_pd(y+i)));
+  for(; i < n; i++)
+    z[i] = x[i]-y[i];
+}
+
+__attribute__((target("avx512f")))
+inline void Vector_Kernels<double>::subtract_avx512(const double* x, const double* y, double* z, unsigned int n)
+{
+  unsigned int i = 0;
+  for(; i+8 <= n; i += 8)
+    _mm512_storeu_pd(z+i, _mm512_sub_pd(_mm512_loadu_pd(x+i), _mm512_loadu_pd(y+i)));
+  for(; i < n; i++)
+    z[i] = x[i]-y[i];
+}
+
+__attribute__((target("sse2")))
+inline void Vector_Kernels<double>::axpy_sse2(double alpha, const double* x, double* y, unsigned int n)
+{
+  __m128d a = _mm_set1_pd(alpha);
+  unsigned int i = 0;
+  for(; i+2 <= n; i += 2)
+    _mm_storeu_pd(y+i, _mm_add_pd(_mm_loadu_pd(y+i), _mm_mul_pd(a, _mm_loadu_pd(x+i))));
+  for(; i < n; i++)
+    y[i] += alpha*x[i];
+}
+
+__attribute__((target("avx2,fma")))
+inline void Vector_Kernels<double>::axpy_avx2(double alpha, const double* x, double* y, unsigned int n)
+{
+  __m256d a = _mm256_set1_pd(alpha);
+  unsigned int i = 0;
+  for(; i+4 <= n; i += 4)
+    _mm256_storeu_pd(y+i, _mm256_fmadd_pd(a, _mm256_loadu_pd(x+i), _mm256_loadu_pd(y+i)));
+  for(; i < n; i++)
+    y[i] += alpha*x[i];
+}
+
+__attribute__((target("avx512f")))
+inline void Vector_Kernels<double>::axpy_avx512(double alpha, const double* x, double* y, unsigned int n)
+{
+  __m512d a = _mm512_set1_pd(alpha);
+  unsigned int i = 0;
+  for(; i+8 <= n; i += 8)
+    _mm512_storeu_pd(y+i, _mm512_fmadd_pd(a, _mm512_loadu_pd(x+i), _mm512_loadu_pd(y+i)));
+  for(; i < n; i++)
+    y[i] += alpha*x[i];
+}
+
+#endif
+
+//--- float ---
+
+inline double Vector_Kernels<float>::dot(const float* x, const float* y, unsigned int n)
+{
+#ifdef VECTOR_KERNELS_X86
+  switch(simd_level())
+  {
+    case SIMD_AVX512:
+      return dot_avx512(x, y, n);
+    case SIMD_AVX2:
+      return dot_avx2(x, y, n);
+    case SIMD_SSE2:
+      return dot_sse2(x, y, n);
+    default:
+      break;
+  }
+#endif
+  double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  unsigned int i = 0;
+  for(; i+4 <= n; i += 4)
+  {
+    s0 += static_cast<double>(x[i])*y[i];
+    s1 += static_cast<double>(x[i+1])*y[i+1];
+    s2 += static_cast<double>(x[i+2])*y[i+2];
+    s3 += static_cast<double>(x[i+3])*y[i+3];
+  }
+  for(; i < n; i++)
+    s0 += static_cast<double>(x[i])*y[i];
+  return (s0+s1)+(s2+s3);
+}
+
+inline void Vector_Kernels<float>::scale(const float* x, const float& alpha, float* z, unsigned int n)
+{
+#ifdef VECTOR_KERNELS_X86
+  switch(simd_level())
+  {
+    case SIMD_AVX512:
+      return scale_avx512(x, alpha, z, n);
+    case SIMD_AVX2:
+      return scale_avx2(x, alpha, z, n);
+    case SIMD_SSE2:
+      return scale_sse2(x, alpha, z, n);
+    default:
+      break;
+  }
+#endif
+  for(unsigned int i = 0; i < n; i++)
+    z[i] = alpha*x[i];
+}
+
+inline void Vector_Kernels<float>::add(const float* x, const float* y, float* z, unsigned int n)
+{
+#ifdef VECTOR_KERNELS_X86
+  switch(simd_level())
+  {
+    case SIMD_AVX512:
+      return add_avx512(x, y, z, n);
+    case SIMD_AVX2:
+      return add_avx2(x, y, z, n);
+    case SIMD_SSE2:
+      return add_sse2(x, y, z, n);
+    default:
+      break;
+  }
+#endif
+  for(unsigned int i = 0; i < n; i++)
+    z[i] = x[i]+y[i];
+}
+
+inline void Vector_Kernels<float>::subtract(const float* x, const float* y, float* z, unsigned int n)
+{
+#ifdef VECTOR_KERNELS_X86
+  switch(simd_level())
+  {
+    case SIMD_AVX512:
+      return subtract_avx512(x, y, z, n);
+    case SIMD_AVX2:
+      return subtract_avx2(x, y, z, n);
+    case SIMD_SSE2:
+      return subtract_sse2(x, y, z, n);
+    default:
+      break;
+  }
+#endif
+  for(unsigned int i = 0; i < n; i++)
+    z[i] = x[i]-y[i];
+}
+
+inline void Vector_Kernels<float>::axpy(const float& alpha, const float* x, float* y, unsigned int n)
+{
+#ifdef VECTOR_KERNELS_X86
+  switch(simd_level())
+  {
+    case SIMD_AVX512:
+      return axpy_avx512(alpha, x, y, n);
+    case SIMD_AVX2:
+      return axpy_avx2(alpha, x, y, n);
+    case SIMD_SSE2:
+      return axpy_sse2(alpha, x, y, n);
+    default:
+      break;
+  }
+#endif
+  for(unsigned int i = 0; i < n; i++)
+    y[i] += alpha*x[i];
+}
+
+#ifdef VECTOR_KERNELS_X86
+
+__attribute__((target("sse2")))
+inline double Vector_Kernels<float>::dot_sse2(const float* x, const float* y, unsigned int n)
+{
+  //Each group of four floats is widened to two pairs of doubles
+  __m128d s0 = _mm_setzero_pd(), s1 = _mm_setzero_pd(), s2 = _mm_setzero_pd(), s3 = _mm_setzero_pd();
+  unsigned int i = 0;
+  for(; i+8 <= n; i += 8)
+  {
+    __m128 xa = _mm_loadu_ps(x+i), ya = _mm_loadu_ps(y+i);
+    __m128 xb = _mm_loadu_ps(x+i+4), yb = _mm_loadu_ps(y+i+4);
+    s0 = _mm_add_pd(s0, _mm_mul_pd(_mm_cvtps_pd(xa), _mm_cvtps_pd(ya)));
+    s1 = _mm_add_pd(s1, _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(xa, xa)), _mm_cvtps_pd(_mm_movehl_ps(ya, ya))));
+    s2 = _mm_add_pd(s2, _mm_mul_pd(_mm_cvtps_pd(xb), _mm_cvtps_pd(yb)));
+    s3 = _mm_add_pd(s3, _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(xb, xb)), _mm_cvtps_pd(_mm_movehl_ps(yb, yb))));
+  }
+  s0 = _mm_add_pd(_mm_add_pd(s0, s1), _mm_add_pd(s2, s3));
+  double lanes[2];
+  _mm_storeu_pd(lanes, s0);
+  double sum = lanes[0]+lanes[1];
+  for(; i < n; i++)
+    sum += static_cast<double>(x[i])*y[i];
+  return sum;
+}
+
+__attribute__((target("avx2,fma")))
+inline double Vector_Kernels<float>::dot_avx2(const float* x, const float* y, unsigned int n)
+{
+  __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd(), s2 = _mm256_setzero_pd(), s3 = _mm256_setzero_pd();
+  unsigned int i = 0;
+  for(; i+16 <= n; i += 16)
+  {
+    s0 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(x+i)), _mm256_cvtps_pd(_mm_loadu_ps(y+i)), s0);
+    s1 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(x+i+4)), _mm256_cvtps_pd(_mm_loadu_ps(y+i+4)), s1);
+    s2 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(x+i+8)), _mm256_cvtps_pd(_mm_loadu_ps(y+i+8)), s2);
+    s3 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(x+i+12)), _mm256_cvtps_pd(_mm_loadu_ps(y+i+12)), s3);
+  }
+  for(; i+4 <= n; i += 4)
+    s0 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(x+i)), _mm256_cvtps_pd(_mm_loadu_ps(y+i)), s0);
+  s0 = _mm256_add_pd(_mm256_add_pd(s0, s1), _mm256_add_pd(s2, s3));
+  __m128d half = _mm_add_pd(_mm256_castpd256_pd128(s0), _mm256_extractf128_pd(s0, 1));
+  double lanes[2];
+  _mm_storeu_pd(lanes, half);
+  double sum = lanes[0]+lanes[1];
+  for(; i < n; i++)
+    sum += static_cast<double>(x[i])*y[i];
+  return sum;
+}
+
+__attribute__((target("avx512f")))
+inline double Vector_Kernels<float>::dot_avx512(const float* x, const float* y, unsigned int n)
+{
+  //The masked conversion with every lane enabled widens eight floats to doubles
+  __m512d s0 = _mm512_setzero_pd(), s1 = _mm512_setzero_pd(), s2 = _mm512_setzero_pd(), s3 = _mm512_setzero_pd();
+  unsigned int i = 0;
+  for(; i+32 <= n; i += 32)
+  {
+    s0 = _mm512_fmadd_pd(_mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(x+i)), _mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(y+i)), s0);
+    s1 = _mm512_fmadd_pd(_mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(x+i+8)), _mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(y+i+8)), s1);
+    s2 = _mm512_fmadd_pd(_mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(x+i+16)), _mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(y+i+16)), s2);
+    s3 = _mm512_fmadd_pd(_mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(x+i+24)), _mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(y+i+24)), s3);
+  }
+  for(; i+8 <= n; i += 8)
+    s0 = _mm512_fmadd_pd(_mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(x+i)), _mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(y+i)), s0);
+  double lanes[8];
+  _mm512_storeu_pd(lanes, _mm512_add_pd(_mm512_add_pd(s0, s1), _mm512_add_pd(s2, s3)));
+  double sum = ((lanes[0]+lanes[1])+(lanes[2]+lanes[3]))+((lanes[4]+lanes[5])+(lanes[6]+lanes[7]));
+  for(; i < n; i++)
+    sum += static_cast<double>(x[i])*y[i];
+  return sum;
+}
+
+__attribute__((target("sse2")))
+inline void Vector_Kernels<float>::scale_sse2(const float* x, float alpha, float* z, unsigned int n)
+{
+  __m128 a = _mm_set1_ps(alpha);
+  unsigned int i = 0;
+  for(; i+4 <= n; i += 4)
+    _mm_storeu_ps(z+i, _mm_mul_ps(a, _mm_loadu_ps(x+i)));
+  for(; i < n; i++)
+    z[i] = alpha*x[i];
+}
+
+__attribute__((target("avx2,fma")))
+inline void Vector_Kernels<float>::scale_avx2(const float* x, float alpha, float* z, unsigned int n)
+{
+  __m256 a = _mm256_set1_ps(alpha);
+  unsigned int i = 0;
+  for(; i+8 <= n; i += 8)
+    _mm256_storeu_ps(z+i, _mm256_mul_ps(a, _mm256_loadu_ps(x+i)));
+  for(; i < n; i++)
+    z[i] = alpha*x[i];
+}
+
+__attribute__((target("avx512f")))
+inline void Vector_Kernels<float>::scale_avx512(const float* x, float alpha, float* z, unsigned int n)
+{
+  __m512 a = _mm512_set1_ps(alpha);
+  unsigned int i = 0;
+  for(; i+16 <= n; i += 16)
+    _mm512_storeu_ps(z+i, _mm512_mul_ps(a, _mm512_loadu_ps(x+i)));
+  for(; i < n; i++)
+    z[i] = alpha*x[i];
+}
+
+__attribute__((target("sse2")))
+inline void Vector_Kernels<float>::add_sse2(const float* x, const float* y, float* z, unsigned int n)
+{
+  unsigned int i = 0;
+  for(; i+4 <= n; i += 4)
+    _mm_storeu_ps(z+i, _mm_add_ps(_mm_loadu_ps(x+i), _mm_loadu_ps(y+i)));
+  for(; i < n; i++)
+    z[i] = x[i]+y[i];
+}
+
+__attribute__((target("avx2,fma")))
+inline void Vector_Kernels<float>::add_avx2(const float* x, const float* y, float* z, unsigned int n)
+{
+  unsigned int i = 0;
+  for(; i+8 <= n; i += 8)
+    _mm256_storeu_ps(z+i, _mm256_add_ps(_mm256_loadu_ps(x+i), _mm256_loadu_ps(y+i)));
+  for(; i < n; i++)
+    z[i] = x[i]+y[i];
+}
+
+__attribute__((target("avx512f")))
+inline void Vector_Kernels<float>::add_avx512(const float* x, const float* y, float* z, unsigned int n)
+{
+  unsigned int i = 0;
+  for(; i+16 <= n; i += 16)
+    _mm512_storeu_ps(z+i, _mm512_add_ps(_mm512_loadu_ps(x+i), _mm512_loadu_ps(y+i)));
+  for(; i < n; i++)
+    z[i] = x[i]+y[i];
+}
+
+__attribute__((target("sse2")))
+inline void Vector_Kernels<float>::subtract_sse2(const float* x, const float* y, float* z, unsigned int n)
+{
+  unsigned int i = 0;
+  for(; i+4 <= n; i += 4)
+    _mm_storeu_ps(z+i, _mm_sub_ps(_mm_loadu_ps(x+i), _mm_loadu_ps(y+i)));
+  for(; i < n; i++)
+    z[i] = x[i]-y[i];
+}
+
+__attribute__((target("avx2,fma")))
+inline void Vector_Kernels<float>::subtract_avx2(const float* x, const float* y, float* z, unsigned int n)
+{
+  unsigned int i = 0;
+  for(; i+8 <= n; i += 8)
+    _mm256_storeu_ps(z+i, _mm256_sub_ps(_mm256_loadu_ps(x+i), _mm256_loadu_ps(y+i)));
+  for(; i < n; i++)
+    z[i] = x[i]-y[i];
+}
+
+__attribute__((target("avx512f")))
+inline void Vector_Kernels<float>::subtract_avx512(const float* x, const float* y, float* z, unsigned int n)
+{
+  unsigned int i = 0;
+  for(; i+16 <= n; i += 16)
+    _mm512_storeu_ps(z+i, _mm512_sub_ps(_mm512_loadu_ps(x+i), _mm512_loadu_ps(y+i)));
+  for(; i < n; i++)
+    z[i] = x[i]-y[i];
+}
+
+__attribute__((target("sse2")))
+inline void Vector_Kernels<float>::axpy_sse2(float alpha, const float* x, float* y, unsigned int n)
+{
+  __m128 a = _mm_set1_ps(alpha);
+  unsigned int i = 0;
+  for(; i+4 <= n; i += 4)
+    _mm_storeu_ps(y+i, _mm_add_ps(_mm_loadu_ps(y+i), _mm_mul_ps(a, _mm_loadu_ps(x+i))));
+  for(; i < n; i++)
+    y[i] += alpha*x[i];
+}
+
+__attribute__((target("avx2,fma")))
+inline void Vector_Kernels<float>::axpy_avx2(float alpha, const float* x, float* y, unsigned int n)
+{
+  __m256 a = _mm256_set1_ps(alpha);
+  unsigned int i = 0;
+  for(; i+8 <= n; i += 8)
+    _mm256_storeu_ps(y+i, _mm256_fmadd_ps(a, _mm256_loadu_ps(x+i), _mm256_loadu_ps(y+i)));
+  for(; i < n; i++)
+    y[i] += alpha*x[i];
+}
+
+__attribute__((target("avx512f")))
+inline void Vector_Kernels<float>::axpy_avx512(float alpha, const float* x, float* y, unsigned int n)
+{
+  __m512 a = _mm512_set1_ps(alpha);
+  unsigned int i = 0;
+  for(; i+16 <= n; i += 16)
+    _mm512_storeu_ps(y+i, _mm512_fmadd_ps(a, _mm512_loadu_ps(x+i), _mm512_loadu_ps(y+i)));
+  for(; i < n; i++)
+    y[i] += alpha*x[i];
+}
+
+#endif